@@ -0,0 +1,15 @@
+# Prints the code size of the functions of the codegen_size benchmark
+# cmake -DNM=<nm> -DBINARY=<codegen_size> -P codegen_size.cmake
+execute_process(COMMAND ${NM} --print-size --defined-only ${BINARY}
+                OUTPUT_VARIABLE symbols
+                RESULT_VARIABLE nm_result)
+if(NOT nm_result EQUAL 0)
+    message(FATAL_ERROR "${NM} failed on ${BINARY}")
+endif()
+string(REPLACE "\n" ";" symbols "${symbols}")
+foreach(symbol ${symbols})
+    if(symbol MATCHES "^[0-9a-fA-F]+ ([0-9a-fA-F]+) [tT] (codegen_[a-z_]+)$")
+        math(EXPR size "0x${CMAKE_MATCH_1}")
+        message("${CMAKE_MATCH_2} ${size} bytes")
+    endif()
+endforeach()
@@ -0,0 +1,42 @@
+// Code size of checked addition loops, compared with the same loop on primitive values.
+// The codegen_size_report target prints the size of each codegen_* function, the failures are reported out of
+// line so the checked loops only grow by the checks themselves. The loop with check_addition_overflow branches
+// once on the result on its hot path, the operands are only tested when the result is infinite. The safe floats
+// only hold their value, the loops load and store the values as the loop on primitive values does.
+#include <cstddef>
+
+#include <boost/safe_float.hpp>
+
+using namespace boost::safe_float;
+
+template<class T>
+static void add_loop(T* out, const T* lhs, const T* rhs, std::size_t size)
+{
+    for (std::size_t i = 0; i < size; ++i) out[i] = lhs[i] + rhs[i];
+}
+
+extern "C" {
+
+__attribute__((noinline)) void codegen_raw_add(double* out, const double* lhs, const double* rhs, std::size_t size)
+{
+    add_loop(out, lhs, rhs, size);
+}
+
+__attribute__((noinline)) void codegen_overflow_add(safe_float<double, policy::check_addition_overflow>* out,
+                                                    const safe_float<double, policy::check_addition_overflow>* lhs,
+                                                    const safe_float<double, policy::check_addition_overflow>* rhs,
+                                                    std::size_t size)
+{
+    add_loop(out, lhs, rhs, size);
+}
+
+__attribute__((noinline)) void codegen_check_all_add(safe_float<double, policy::check_all>* out,
+                                                     const safe_float<double, policy::check_all>* lhs,
+                                                     const safe_float<double, policy::check_all>* rhs,
+                                                     std::size_t size)
+{
+    add_loop(out, lhs, rhs, size);
+}
+}
+
+int main() { return 0; }
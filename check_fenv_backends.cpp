@@ -0,0 +1,196 @@
+// Probe used by the build scripts to select how the CHECK policies detect failures for each floating point type.
+//
+// It is built once for each mode with BOOST_SAFE_FLOAT_FENV_PROBE_MODE (0: value checks, 1: libc flags, 2: native
+// flags). Running a build checks the compiler keeps the flags manipulation around the operations, so failures are
+// detected, and measures the cost of checked operations. It outputs one line per floating point type:
+//     <type> <mode> <correct> <nanoseconds per operation>
+//
+// Running any build with --generate <results>... writes the configuration header selecting, for each type, the
+// fastest mode reading the flags that detected every failure and costs less than 95% of the value checks, or the
+// value checks. The results may be given in any order.
+
+#ifndef BOOST_SAFE_FLOAT_FENV_PROBE_MODE
+#define BOOST_SAFE_FLOAT_FENV_PROBE_MODE 0
+#endif
+
+#define BOOST_SAFE_FLOAT_NO_FENV_CONFIG
+#define BOOST_SAFE_FLOAT_FENV_MODE_FLOAT BOOST_SAFE_FLOAT_FENV_PROBE_MODE
+#define BOOST_SAFE_FLOAT_FENV_MODE_DOUBLE BOOST_SAFE_FLOAT_FENV_PROBE_MODE
+#define BOOST_SAFE_FLOAT_FENV_MODE_LONG_DOUBLE BOOST_SAFE_FLOAT_FENV_PROBE_MODE
+
+#include <boost/safe_float.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace boost::safe_float;
+
+namespace
+{
+struct counting_report
+{
+    static inline unsigned long failures = 0;
+    void report_failure(const std::string&) { ++failures; }
+};
+
+template<class FP>
+using probe_float = safe_float<FP, policy::check_all, counting_report>;
+
+// Each operation is written with constants, the compiler is free to fold them if nothing prevents it.
+// Only failures also detected by the value checks are used, so every mode is expected to pass.
+template<class FP>
+bool detects_failures()
+{
+    using sf = probe_float<FP>;
+    auto fails = [](auto&& operation) {
+        unsigned long const before = counting_report::failures;
+        operation();
+        return counting_report::failures != before;
+    };
+
+    sf max(std::numeric_limits<FP>::max());
+    sf min(std::numeric_limits<FP>::min());
+    sf inf(std::numeric_limits<FP>::infinity());
+    sf zero(FP(0));
+    sf one(FP(1));
+    sf two(FP(2));
+    sf three(FP(3));
+    sf six(FP(6));
+    sf half_epsilon(std::numeric_limits<FP>::epsilon() / 2);
+
+    bool correct = true;
+    // failing operations
+    correct &= fails([&] { max + max; });       // overflow
+    correct &= fails([&] { inf - inf; });       // invalid
+    correct &= fails([&] { one / zero; });      // division by zero
+    correct &= fails([&] { min / three; });     // underflow
+    correct &= fails([&] { one + half_epsilon; }); // inexact
+    correct &= fails([&] { max * two; });       // overflow
+    // exact operations
+    correct &= !fails([&] { one + one; });
+    correct &= !fails([&] { three - one; });
+    correct &= !fails([&] { three * two; });
+    correct &= !fails([&] { six / two; });
+    return correct;
+}
+
+template<class FP>
+double nanoseconds_per_operation()
+{
+    using sf = probe_float<FP>;
+    // small integers, every operation is exact and the failure path is never taken
+    std::vector<sf> values;
+    for (int i = 0; i < 1024; ++i) values.emplace_back(FP(1 + i % 7));
+
+    double best = std::numeric_limits<double>::max();
+    for (int run = 0; run < 5; ++run)
+    {
+        sf acc(FP(1));
+        auto const start = std::chrono::steady_clock::now();
+        for (int rep = 0; rep < 64; ++rep)
+        {
+            for (std::size_t i = 0; i + 1 < values.size(); ++i)
+            {
+                sf const sum = values[i] + values[i + 1];
+                sf const product = sum * values[i];
+                acc = (product - values[i + 1]) / acc;
+                acc = values[i] / values[i];
+            }
+        }
+        auto const stop = std::chrono::steady_clock::now();
+        double const operations = 64.0 * 5 * (values.size() - 1);
+        best = std::min(best, std::chrono::duration<double, std::nano>(stop - start).count() / operations);
+        // keep the result alive
+        if (acc.get_stored_value() == FP(-1)) std::cerr << "";
+    }
+    return best;
+}
+
+template<class FP>
+void probe(const char* name)
+{
+    bool const correct = detects_failures<FP>();
+    double const cost = nanoseconds_per_operation<FP>();
+    std::cout << name << ' ' << BOOST_SAFE_FLOAT_FENV_PROBE_MODE << ' ' << correct << ' ' << cost << '\n';
+}
+
+int generate(int argc, char** argv)
+{
+    struct result
+    {
+        bool correct = false;
+        double cost = std::numeric_limits<double>::max();
+    };
+    // the results of each mode for each type
+    std::map<std::string, std::map<int, result>> results;
+    std::map<std::string, std::string> measures;
+
+    for (int i = 2; i < argc; ++i)
+    {
+        std::ifstream in(argv[i]);
+        std::string line;
+        while (std::getline(in, line))
+        {
+            std::istringstream fields(line);
+            std::string type;
+            int mode = 0;
+            bool correct = false;
+            double cost = 0;
+            if (!(fields >> type >> mode >> correct >> cost)) continue;
+            std::ostringstream measure;
+            measure << " mode " << mode << (correct ? "" : " (incorrect)") << ": " << cost << "ns";
+            measures[type] += measure.str();
+            results[type][mode] = result{correct, cost};
+        }
+    }
+
+    // Value checks are always correct, they are the fallback. A mode reading the flags is selected when it
+    // detected every failure and is faster than the value checks by the margin, the fastest of them wins
+    constexpr double margin = 0.95;
+    std::map<std::string, int> selected;
+    for (auto const& [type, modes] : results)
+    {
+        auto const fallback = modes.find(0);
+        double best = fallback == modes.end() ? std::numeric_limits<double>::max() : fallback->second.cost * margin;
+        selected[type] = 0;
+        for (auto const& [mode, measured] : modes)
+        {
+            if (mode != 0 && measured.correct && measured.cost < best)
+            {
+                best = measured.cost;
+                selected[type] = mode;
+            }
+        }
+    }
+
+    std::cout << "// Generated by check_fenv_backends.cpp, do not edit\n"
+              << "#ifndef BOOST_SAFE_FLOAT_FENV_CONFIG_HPP\n"
+              << "#define BOOST_SAFE_FLOAT_FENV_CONFIG_HPP\n\n";
+    for (auto const& [type, macro] : {std::pair<std::string, std::string>{"float", "FLOAT"},
+                                      {"double", "DOUBLE"},
+                                      {"long_double", "LONG_DOUBLE"}})
+    {
+        std::cout << "//" << measures[type] << '\n'
+                  << "#define BOOST_SAFE_FLOAT_FENV_MODE_" << macro << ' ' << selected[type] << "\n\n";
+    }
+    std::cout << "#endif // BOOST_SAFE_FLOAT_FENV_CONFIG_HPP\n";
+    return 0;
+}
+} // namespace
+
+int main(int argc, char** argv)
+{
+    if (argc > 1 && std::string(argv[1]) == "--generate") return generate(argc, argv);
+
+    probe<float>("float");
+    probe<double>("double");
+    probe<long double>("long_double");
+    return 0;
+}
@@ -1,9 +1,16 @@
 #ifndef BOOST_SAFE_FLOAT_HPP
 #define BOOST_SAFE_FLOAT_HPP
 
+#include <cctype>
+#include <functional>
 #include <iostream>
+#include <string>
+#include <utility>
 
 #include <boost/safe_float/convenience.hpp>
+#include <boost/safe_float/detail/charconv.hpp>
+#include <boost/safe_float/detail/config.hpp>
+#include <boost/safe_float/detail/fenv_backend.hpp>
 #include <boost/safe_float/policy/on_fail_throw.hpp>
 
 
@@ -13,14 +20,82 @@ namespace safe_float
 {
 template<class FP, template<class T> class CHECK = policy::check_all, class ERROR_HANDLING = policy::on_fail_throw,
          template<class T> class CAST = policy::cast_from_primitive::same>
-class safe_float : private CHECK<FP>, ERROR_HANDLING
+class safe_float : private ERROR_HANDLING
 {
     FP number;
     
     using pol = CHECK<FP>;
     using traits = policy::policy_traits<FP, CHECK<FP>>;
-    pol& policy() noexcept { return static_cast<pol&>(*this); }
-    ERROR_HANDLING& handler() noexcept { return static_cast<ERROR_HANDLING&>(*this); }
+    constexpr ERROR_HANDLING& handler() noexcept { return static_cast<ERROR_HANDLING&>(*this); }
+
+    // Operations are noexcept when neither the checks nor the report policy throw
+#define BOOST_SAFE_FLOAT_NOTHROW_OPERATION(operation)                                                          \
+    static constexpr bool nothrow_##operation =                                                                \
+        noexcept(traits::report_pre_##operation(std::declval<pol&>(), std::declval<const FP&>(),               \
+                                                std::declval<const FP&>(), std::declval<ERROR_HANDLING&>()))   \
+        && noexcept(traits::report_post_##operation(std::declval<pol&>(), std::declval<const FP&>(),           \
+                                                    std::declval<ERROR_HANDLING&>()));
+
+    BOOST_SAFE_FLOAT_NOTHROW_OPERATION(addition)
+    BOOST_SAFE_FLOAT_NOTHROW_OPERATION(subtraction)
+    BOOST_SAFE_FLOAT_NOTHROW_OPERATION(multiplication)
+    BOOST_SAFE_FLOAT_NOTHROW_OPERATION(division)
+
+#undef BOOST_SAFE_FLOAT_NOTHROW_OPERATION
+
+    // Applies the operation, when checks rely on flags it is kept between the pre and post checks
+    template<typename OP>
+    static constexpr FP apply(FP lhs, FP rhs, OP op)
+    {
+        return detail::ordered_apply<FP, pol>(lhs, rhs, op);
+    }
+
+    // Checks and applies the operation in place, the stored value is the left operand of assign and the right one
+    // of reversed, written when the other operand is a scalar or the value expires. Each operation runs its checks
+    // on a new check policy, the state they keep between the pre and post checks stays in registers and the safe
+    // float only stores its value
+#define BOOST_SAFE_FLOAT_IN_PLACE_OPERATION(operation, OP)                                               \
+    constexpr void assign_##operation(FP rhs) noexcept(nothrow_##operation)                              \
+    {                                                                                                    \
+        pol checks{};                                                                                    \
+        traits::report_pre_##operation(checks, number, rhs, handler()); /* early error detection */     \
+        number = apply(number, rhs, OP<FP>{});                                                           \
+        traits::report_post_##operation(checks, number, handler());                                      \
+    }                                                                                                    \
+                                                                                                         \
+    constexpr void reversed_##operation(FP lhs) noexcept(nothrow_##operation)                            \
+    {                                                                                                    \
+        FP const rhs = number;                                                                           \
+        pol checks{};                                                                                    \
+        traits::report_pre_##operation(checks, lhs, rhs, handler()); /* early error detection */        \
+        number = apply(lhs, rhs, OP<FP>{});                                                              \
+        traits::report_post_##operation(checks, number, handler());                                      \
+    }
+
+    BOOST_SAFE_FLOAT_IN_PLACE_OPERATION(addition, std::plus)
+    BOOST_SAFE_FLOAT_IN_PLACE_OPERATION(subtraction, std::minus)
+    BOOST_SAFE_FLOAT_IN_PLACE_OPERATION(multiplication, std::multiplies)
+    BOOST_SAFE_FLOAT_IN_PLACE_OPERATION(division, std::divides)
+
+#undef BOOST_SAFE_FLOAT_IN_PLACE_OPERATION
+
+    // Scalars the cast policy converts implicitly are operands, converted without constructing a safe_float
+    template<typename T>
+    static constexpr bool scalar_operand
+        = std::is_arithmetic<T>::value && CAST<safe_float>::template can_cast_from<T>;
+
+    template<typename T>
+    static constexpr bool nothrow_scalar
+        = noexcept(policy::cast_helper<FP, CAST<safe_float>>::template construct_implicitly(std::declval<FP&>(),
+                                                                                           std::declval<T>()));
+
+    template<typename T>
+    static constexpr FP scalar_value(T scalar) noexcept(nothrow_scalar<T>)
+    {
+        FP value{};
+        policy::cast_helper<FP, CAST<safe_float>>::template construct_implicitly(value, scalar);
+        return value;
+    }
 
 public:
     
@@ -32,7 +107,7 @@ public:
     static_assert(std::is_floating_point<FP>::value,
                   "First template parameter in safe_float has to be floating point data type");
 
-    safe_float() : safe_float((FP)0.0f) {}
+    constexpr safe_float() noexcept : safe_float((FP)0.0f) {}
 
     // Explicit constructor for FP in case the cast policy doesn't allow construction already
     template<
@@ -42,74 +117,116 @@ public:
                 FP,
                 OtherFP> && !CAST<safe_float>::template can_explicitly_cast_from<OtherFP> && !CAST<safe_float>::template can_cast_from<OtherFP>,
             int> = 0>
-    explicit safe_float(OtherFP f) : number{f}
+    constexpr explicit safe_float(OtherFP f) noexcept : number{f}
     {}
 
     // Explicit constructors available through the cast policy
     template<typename T, std::enable_if_t<CAST<safe_float>::template can_explicitly_cast_from<T>, int> = 0>
-    explicit safe_float(T source)
+    constexpr explicit safe_float(T source) noexcept(
+        noexcept(policy::cast_helper<FP, CAST<safe_float>>::template construct_explicitly(std::declval<FP&>(), source)))
+        : number{}
     {
         policy::cast_helper<FP, CAST<safe_float>>::template construct_explicitly(number, source);
     }
 
     // Implicit constructors available through the cast policy
     template<typename T, std::enable_if_t<CAST<safe_float>::template can_cast_from<T>, int> = 0>
-    safe_float(T source)
+    constexpr safe_float(T source) noexcept(
+        noexcept(policy::cast_helper<FP, CAST<safe_float>>::template construct_implicitly(std::declval<FP&>(), source)))
+        : number{}
     {
         policy::cast_helper<FP, CAST<safe_float>>::template construct_implicitly(number, source);
     }
 
     // Conversion operators
     template<typename T, std::enable_if_t<CAST<safe_float>::template can_cast_to<T>, int> = 0>
-    operator T () {
+    constexpr operator T () noexcept(
+        noexcept(policy::cast_helper<FP, CAST<safe_float>>::template convert_implicitly<T>(FP()))) {
         return policy::cast_helper<FP, CAST<safe_float>>::template convert_implicitly<T>(number);
     }
 
     template<typename T, std::enable_if_t<CAST<safe_float>::template can_explicitly_cast_to<T>, int> = 0>
-    explicit operator T () {
+    constexpr explicit operator T () noexcept(
+        noexcept(policy::cast_helper<FP, CAST<safe_float>>::template convert_explicitly<T>(FP()))) {
         return policy::cast_helper<FP, CAST<safe_float>>::template convert_explicitly<T>(number);
     }
     
 
     // Access to internal representation
-    FP get_stored_value() const { return number; }
-    void set_stored_value(FP f) { number = f; }
+    constexpr FP get_stored_value() const noexcept { return number; }
+    constexpr void set_stored_value(FP f) noexcept { number = f; }
 
     // unary arithmetic operators implementation
-    safe_float<FP, CHECK, ERROR_HANDLING, CAST>& operator+=(const safe_float<FP, CHECK, ERROR_HANDLING, CAST>& rhs)
+    constexpr safe_float<FP, CHECK, ERROR_HANDLING, CAST>&
+    operator+=(const safe_float<FP, CHECK, ERROR_HANDLING, CAST>& rhs) noexcept(nothrow_addition)
     {
-        traits::report_pre_addition(policy(), number, rhs.number, handler()); // early error detection
-        number += rhs.number;
-        traits::report_post_addition(policy(), number, handler());
+        assign_addition(rhs.number);
         return *this;
     }
 
-    safe_float<FP, CHECK, ERROR_HANDLING, CAST>& operator-=(const safe_float<FP, CHECK, ERROR_HANDLING, CAST>& rhs)
+    constexpr safe_float<FP, CHECK, ERROR_HANDLING, CAST>&
+    operator-=(const safe_float<FP, CHECK, ERROR_HANDLING, CAST>& rhs) noexcept(nothrow_subtraction)
     {
-        traits::report_pre_subtraction(policy(), number, rhs.number, handler()); // early error detection
-        number -= rhs.number;
-        traits::report_post_subtraction(policy(), number, handler());
+        assign_subtraction(rhs.number);
         return *this;
     }
 
-    safe_float<FP, CHECK, ERROR_HANDLING, CAST>& operator*=(const safe_float<FP, CHECK, ERROR_HANDLING, CAST>& rhs)
+    constexpr safe_float<FP, CHECK, ERROR_HANDLING, CAST>&
+    operator*=(const safe_float<FP, CHECK, ERROR_HANDLING, CAST>& rhs) noexcept(nothrow_multiplication)
     {
-        traits::report_pre_multiplication(policy(), number, rhs.number, handler()); // early error detection
-        number *= rhs.number;
-        traits::report_post_multiplication(policy(), number, handler());
+        assign_multiplication(rhs.number);
         return *this;
     }
 
-    safe_float<FP, CHECK, ERROR_HANDLING, CAST>& operator/=(const safe_float<FP, CHECK, ERROR_HANDLING, CAST>& rhs)
+    constexpr safe_float<FP, CHECK, ERROR_HANDLING, CAST>&
+    operator/=(const safe_float<FP, CHECK, ERROR_HANDLING, CAST>& rhs) noexcept(nothrow_division)
     {
-        traits::report_pre_division(policy(), number, rhs.number, handler()); // early error detection
-        number /= rhs.number;
-        traits::report_post_division(policy(), number, handler());
+        assign_division(rhs.number);
         return *this;
     }
 
+    // operations with scalars and with expiring right operands, the checks run once on the values
+#define BOOST_SAFE_FLOAT_SCALAR_OPERATION(symbol, operation)                                                   \
+    template<typename T, std::enable_if_t<scalar_operand<T>, int> = 0>                                         \
+    constexpr safe_float& operator symbol##=(T rhs) noexcept(nothrow_##operation && nothrow_scalar<T>)        \
+    {                                                                                                          \
+        assign_##operation(scalar_value(rhs));                                                                 \
+        return *this;                                                                                          \
+    }                                                                                                          \
+                                                                                                               \
+    template<typename T, std::enable_if_t<scalar_operand<T>, int> = 0>                                         \
+    friend constexpr safe_float operator symbol(safe_float lhs, T rhs) noexcept(nothrow_##operation            \
+                                                                                && nothrow_scalar<T>)          \
+    {                                                                                                          \
+        lhs.assign_##operation(scalar_value(rhs));                                                             \
+        return lhs;                                                                                            \
+    }                                                                                                          \
+                                                                                                               \
+    template<typename T, std::enable_if_t<scalar_operand<T>, int> = 0>                                         \
+    friend constexpr safe_float operator symbol(T lhs, safe_float rhs) noexcept(nothrow_##operation            \
+                                                                                && nothrow_scalar<T>)          \
+    {                                                                                                          \
+        rhs.reversed_##operation(scalar_value(lhs));                                                           \
+        return rhs;                                                                                            \
+    }                                                                                                          \
+                                                                                                               \
+    friend constexpr safe_float operator symbol(const safe_float& lhs, safe_float&& rhs)                       \
+        noexcept(nothrow_##operation && std::is_nothrow_move_constructible<safe_float>::value)                 \
+    {                                                                                                          \
+        rhs.reversed_##operation(lhs.number);                                                                  \
+        return std::move(rhs);                                                                                 \
+    }
+
+    BOOST_SAFE_FLOAT_SCALAR_OPERATION(+, addition)
+    BOOST_SAFE_FLOAT_SCALAR_OPERATION(-, subtraction)
+    BOOST_SAFE_FLOAT_SCALAR_OPERATION(*, multiplication)
+    BOOST_SAFE_FLOAT_SCALAR_OPERATION(/, division)
+
+#undef BOOST_SAFE_FLOAT_SCALAR_OPERATION
+
     // unary negative operator
-    safe_float<FP, CHECK, ERROR_HANDLING, CAST> operator-() const
+    constexpr safe_float<FP, CHECK, ERROR_HANDLING, CAST> operator-() const
+        noexcept(std::is_nothrow_constructible_v<safe_float<FP, CHECK, ERROR_HANDLING, CAST>, FP>)
     {
         return safe_float<FP, CHECK, ERROR_HANDLING, CAST>(-number);
     }
@@ -117,32 +234,36 @@ public:
 
 // binary arithmetic operators
 template<class FP, template<class T> class CHECK, class ERROR_HANDLING, template<class T> class CAST>
-inline safe_float<FP, CHECK, ERROR_HANDLING, CAST> operator+(safe_float<FP, CHECK, ERROR_HANDLING, CAST> lhs,
-                                                             const safe_float<FP, CHECK, ERROR_HANDLING, CAST>& rhs)
+constexpr safe_float<FP, CHECK, ERROR_HANDLING, CAST> operator+(safe_float<FP, CHECK, ERROR_HANDLING, CAST> lhs,
+                                                                const safe_float<FP, CHECK, ERROR_HANDLING, CAST>& rhs)
+    noexcept(noexcept(lhs += rhs))
 {
     lhs += rhs;
     return lhs;
 }
 
 template<class FP, template<class T> class CHECK, class ERROR_HANDLING, template<class T> class CAST>
-inline safe_float<FP, CHECK, ERROR_HANDLING, CAST> operator-(safe_float<FP, CHECK, ERROR_HANDLING, CAST> lhs,
-                                                             const safe_float<FP, CHECK, ERROR_HANDLING, CAST>& rhs)
+constexpr safe_float<FP, CHECK, ERROR_HANDLING, CAST> operator-(safe_float<FP, CHECK, ERROR_HANDLING, CAST> lhs,
+                                                                const safe_float<FP, CHECK, ERROR_HANDLING, CAST>& rhs)
+    noexcept(noexcept(lhs -= rhs))
 {
     lhs -= rhs;
     return lhs;
 }
 
 template<class FP, template<class T> class CHECK, class ERROR_HANDLING, template<class T> class CAST>
-inline safe_float<FP, CHECK, ERROR_HANDLING, CAST> operator*(safe_float<FP, CHECK, ERROR_HANDLING, CAST> lhs,
-                                                             const safe_float<FP, CHECK, ERROR_HANDLING, CAST>& rhs)
+constexpr safe_float<FP, CHECK, ERROR_HANDLING, CAST> operator*(safe_float<FP, CHECK, ERROR_HANDLING, CAST> lhs,
+                                                                const safe_float<FP, CHECK, ERROR_HANDLING, CAST>& rhs)
+    noexcept(noexcept(lhs *= rhs))
 {
     lhs *= rhs;
     return lhs;
 }
 
 template<class FP, template<class T> class CHECK, class ERROR_HANDLING, template<class T> class CAST>
-inline safe_float<FP, CHECK, ERROR_HANDLING, CAST> operator/(safe_float<FP, CHECK, ERROR_HANDLING, CAST> lhs,
-                                                             const safe_float<FP, CHECK, ERROR_HANDLING, CAST>& rhs)
+constexpr safe_float<FP, CHECK, ERROR_HANDLING, CAST> operator/(safe_float<FP, CHECK, ERROR_HANDLING, CAST> lhs,
+                                                                const safe_float<FP, CHECK, ERROR_HANDLING, CAST>& rhs)
+    noexcept(noexcept(lhs /= rhs))
 {
     lhs /= rhs;
     return lhs;
@@ -150,61 +271,109 @@ inline safe_float<FP, CHECK, ERROR_HANDLING, CAST> operator/(safe_float<FP, CHEC
 
 // comparison operators
 template<class FP, template<class T> class CHECK, class ERROR_HANDLING, template<class T> class CAST>
-inline bool operator<(const safe_float<FP, CHECK, ERROR_HANDLING, CAST>& lhs,
-                      const safe_float<FP, CHECK, ERROR_HANDLING, CAST>& rhs)
+constexpr bool operator<(const safe_float<FP, CHECK, ERROR_HANDLING, CAST>& lhs,
+                         const safe_float<FP, CHECK, ERROR_HANDLING, CAST>& rhs) noexcept
 {
     return lhs.get_stored_value() < rhs.get_stored_value();
 }
 
 template<class FP, template<class T> class CHECK, class ERROR_HANDLING, template<class T> class CAST>
-inline bool operator>(const safe_float<FP, CHECK, ERROR_HANDLING, CAST>& lhs,
-                      const safe_float<FP, CHECK, ERROR_HANDLING, CAST>& rhs)
+constexpr bool operator>(const safe_float<FP, CHECK, ERROR_HANDLING, CAST>& lhs,
+                         const safe_float<FP, CHECK, ERROR_HANDLING, CAST>& rhs) noexcept
 {
     return rhs < lhs;
 }
 
 template<class FP, template<class T> class CHECK, class ERROR_HANDLING, template<class T> class CAST>
-inline bool operator<=(const safe_float<FP, CHECK, ERROR_HANDLING, CAST>& lhs,
-                       const safe_float<FP, CHECK, ERROR_HANDLING, CAST>& rhs)
+constexpr bool operator<=(const safe_float<FP, CHECK, ERROR_HANDLING, CAST>& lhs,
+                          const safe_float<FP, CHECK, ERROR_HANDLING, CAST>& rhs) noexcept
 {
     return !(lhs > rhs);
 }
 
 template<class FP, template<class T> class CHECK, class ERROR_HANDLING, template<class T> class CAST>
-inline bool operator>=(const safe_float<FP, CHECK, ERROR_HANDLING, CAST>& lhs,
-                       const safe_float<FP, CHECK, ERROR_HANDLING, CAST>& rhs)
+constexpr bool operator>=(const safe_float<FP, CHECK, ERROR_HANDLING, CAST>& lhs,
+                          const safe_float<FP, CHECK, ERROR_HANDLING, CAST>& rhs) noexcept
 {
     return !(lhs < rhs);
 }
 
 template<class FP, template<class T> class CHECK, class ERROR_HANDLING, template<class T> class CAST>
-inline bool operator==(const safe_float<FP, CHECK, ERROR_HANDLING, CAST>& lhs,
-                       const safe_float<FP, CHECK, ERROR_HANDLING, CAST>& rhs)
+constexpr bool operator==(const safe_float<FP, CHECK, ERROR_HANDLING, CAST>& lhs,
+                          const safe_float<FP, CHECK, ERROR_HANDLING, CAST>& rhs) noexcept
 {
     return lhs.get_stored_value() == rhs.get_stored_value();
 }
 
 template<class FP, template<class T> class CHECK, class ERROR_HANDLING, template<class T> class CAST>
-inline bool operator!=(const safe_float<FP, CHECK, ERROR_HANDLING, CAST>& lhs,
-                       const safe_float<FP, CHECK, ERROR_HANDLING, CAST>& rhs)
+constexpr bool operator!=(const safe_float<FP, CHECK, ERROR_HANDLING, CAST>& lhs,
+                          const safe_float<FP, CHECK, ERROR_HANDLING, CAST>& rhs) noexcept
 {
     return !(lhs == rhs);
 }
 
-// iostream operators
+// iostream operators, the value is written as the stream writes FP
 template<class FP, template<class T> class CHECK, class ERROR_HANDLING, template<class T> class CAST>
-inline std::ostream& operator<<(std::ostream& out, safe_float<FP, CHECK, ERROR_HANDLING, CAST>& sf)
+inline std::ostream& operator<<(std::ostream& out, const safe_float<FP, CHECK, ERROR_HANDLING, CAST>& sf)
 {
-    out << sf.get_stored_value();
+    if (!detail::write_number(out, sf.get_stored_value())) out << sf.get_stored_value();
     return out;
 }
 
+// Reads a number as std::num_get does, the characters stop at the first one that can't continue the number and
+// are left in the stream. The value is checked as from_chars checks it, except for the rounding of the decimal
+// digits to the nearest value, reading the max_digits10 digits a stream writes gives the value back
 template<class FP, template<class T> class CHECK, class ERROR_HANDLING, template<class T> class CAST>
 inline std::istream& operator>>(std::istream& in, safe_float<FP, CHECK, ERROR_HANDLING, CAST>& sf)
 {
+    std::istream::sentry const sentry(in);
+    if (!sentry) return in;
+
+    // sign, digits with a point, then an exponent after the digits
+    std::string token;
+    bool digits = false, point = false, exponent = false;
+    for (std::istream::int_type c = in.peek();; c = in.peek())
+    {
+        if (c == std::istream::traits_type::eof())
+        {
+            in.setstate(std::ios::eofbit);
+            break;
+        }
+        char const ch = std::istream::traits_type::to_char_type(c);
+        if (std::isdigit(static_cast<unsigned char>(ch)))
+            digits = true;
+        else if (ch == '-' || ch == '+')
+        {
+            if (!token.empty() && (token.back() | 0x20) != 'e') break;
+        }
+        else if (ch == '.')
+        {
+            if (point || exponent) break;
+            point = true;
+        }
+        else if ((ch | 0x20) == 'e')
+        {
+            if (!digits || exponent) break;
+            exponent = true;
+        }
+        else
+            break;
+        token.push_back(ch);
+        in.get();
+    }
+
+    const char* const first = token.data() + (!token.empty() && token[0] == '+');
+    const char* const last = token.data() + token.size();
     FP number;
-    in >> number;
+    std::from_chars_result const result = detail::checked_from_chars<FP, CHECK<FP>, ERROR_HANDLING>(
+        first, last, number, std::chars_format::general, false);
+    if (result.ec == std::errc::invalid_argument || result.ptr != last)
+    {
+        in.setstate(std::ios::failbit);
+        return in;
+    }
     sf.set_stored_value(number);
+    if (result.ec != std::errc()) in.setstate(std::ios::failbit);
     return in;
 }
 
@@ -248,37 +417,37 @@ public:
     static constexpr float_round_style round_style =
         std::numeric_limits<FP>::round_style; // TODO: check inexact policies
 
-    static constexpr number_type min() noexcept(std::numeric_limits<FP>::min())
+    static constexpr number_type min() noexcept
     {
         return boost::safe_float::safe_float<FP, CHECK, ERROR_HANDLING, CAST>(std::numeric_limits<FP>::min());
     }
-    static constexpr number_type max() noexcept(std::numeric_limits<FP>::max())
+    static constexpr number_type max() noexcept
     {
         return boost::safe_float::safe_float<FP, CHECK, ERROR_HANDLING, CAST>(std::numeric_limits<FP>::max());
     }
-    static constexpr number_type lowest() noexcept(max) { return -(max)(); }
-    static constexpr number_type epsilon() noexcept(std::numeric_limits<FP>::epsilon())
+    static constexpr number_type lowest() noexcept { return -(max)(); }
+    static constexpr number_type epsilon() noexcept
     {
         return boost::safe_float::safe_float<FP, CHECK, ERROR_HANDLING, CAST>(std::numeric_limits<FP>::epsilon());
     }
-    static constexpr number_type round_error() noexcept(std::numeric_limits<FP>::round_error())
+    static constexpr number_type round_error() noexcept
     {
         // TODO: check for inexact policies
         return boost::safe_float::safe_float<FP, CHECK, ERROR_HANDLING, CAST>(std::numeric_limits<FP>::round_error());
     }
-    static constexpr number_type infinity() noexcept(std::numeric_limits<FP>::infinity())
+    static constexpr number_type infinity() noexcept
     {
         return boost::safe_float::safe_float<FP, CHECK, ERROR_HANDLING, CAST>(std::numeric_limits<FP>::infinity());
     }
-    static constexpr number_type quiet_NaN() noexcept(std::numeric_limits<FP>::quiet_NaN())
+    static constexpr number_type quiet_NaN() noexcept
     {
         return boost::safe_float::safe_float<FP, CHECK, ERROR_HANDLING, CAST>(std::numeric_limits<FP>::quiet_NaN());
     }
-    static constexpr number_type signaling_NaN() noexcept(std::numeric_limits<FP>::signaling_NaN())
+    static constexpr number_type signaling_NaN() noexcept
     {
         return boost::safe_float::safe_float<FP, CHECK, ERROR_HANDLING, CAST>(std::numeric_limits<FP>::signaling_NaN());
     }
-    static number_type denorm_min() noexcept(std::numeric_limits<FP>::denorm_min())
+    static constexpr number_type denorm_min() noexcept
     {
         return boost::safe_float::safe_float<FP, CHECK, ERROR_HANDLING, CAST>(std::numeric_limits<FP>::denorm_min());
     }
@@ -0,0 +1,135 @@
+#ifndef BOOST_SAFE_FLOAT_ALLOCATOR_HPP
+#define BOOST_SAFE_FLOAT_ALLOCATOR_HPP
+
+#include <cstddef>
+#include <limits>
+#include <new>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#endif
+
+namespace boost
+{
+namespace safe_float
+{
+/**
+ * Allocator returning storage aligned to ALIGNMENT bytes, by default the size of a cache line, so the
+ * vector units load whole registers from the beginning of a container.
+ */
+template<class T, std::size_t ALIGNMENT = 64>
+class aligned_allocator
+{
+    static_assert(ALIGNMENT != 0 && (ALIGNMENT & (ALIGNMENT - 1)) == 0, "The alignment has to be a power of two");
+    static_assert(ALIGNMENT >= alignof(T), "The alignment can't be weaker than the one of the type");
+
+public:
+    using value_type = T;
+    static constexpr std::size_t alignment = ALIGNMENT;
+
+    template<class U>
+    struct rebind
+    {
+        using other = aligned_allocator<U, ALIGNMENT>;
+    };
+
+    constexpr aligned_allocator() noexcept = default;
+
+    template<class U>
+    constexpr aligned_allocator(const aligned_allocator<U, ALIGNMENT>&) noexcept
+    {
+    }
+
+    T* allocate(std::size_t n)
+    {
+        if (n > std::numeric_limits<std::size_t>::max() / sizeof(T)) throw std::bad_array_new_length();
+        return static_cast<T*>(::operator new(n * sizeof(T), std::align_val_t(ALIGNMENT)));
+    }
+
+    void deallocate(T* p, std::size_t) noexcept { ::operator delete(p, std::align_val_t(ALIGNMENT)); }
+
+    template<class U>
+    constexpr bool operator==(const aligned_allocator<U, ALIGNMENT>&) const noexcept
+    {
+        return true;
+    }
+
+    template<class U>
+    constexpr bool operator!=(const aligned_allocator<U, ALIGNMENT>&) const noexcept
+    {
+        return false;
+    }
+};
+
+/**
+ * Allocator placing large containers on huge pages, so millions of values are covered by a few entries of
+ * the translation buffers.
+ *
+ * Allocations of at least huge_page_size bytes are aligned to a huge page, rounded up to whole huge pages,
+ * and advised to be backed by transparent huge pages on Linux. Smaller allocations are aligned to a cache
+ * line. The advice is a hint, the storage is usable when the system ignores it.
+ */
+template<class T>
+class huge_page_allocator
+{
+    static std::size_t huge_bytes(std::size_t bytes) noexcept
+    {
+        return (bytes + huge_page_size - 1) / huge_page_size * huge_page_size;
+    }
+
+public:
+    using value_type = T;
+    static constexpr std::size_t huge_page_size = std::size_t(2) << 20;
+
+    template<class U>
+    struct rebind
+    {
+        using other = huge_page_allocator<U>;
+    };
+
+    constexpr huge_page_allocator() noexcept = default;
+
+    template<class U>
+    constexpr huge_page_allocator(const huge_page_allocator<U>&) noexcept
+    {
+    }
+
+    T* allocate(std::size_t n)
+    {
+        if (n > (std::numeric_limits<std::size_t>::max() - huge_page_size) / sizeof(T))
+            throw std::bad_array_new_length();
+        std::size_t const bytes = n * sizeof(T);
+        if (bytes < huge_page_size) return aligned_allocator<T>().allocate(n);
+
+        void* p = ::operator new(huge_bytes(bytes), std::align_val_t(huge_page_size));
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+        ::madvise(p, huge_bytes(bytes), MADV_HUGEPAGE);
+#endif
+        return static_cast<T*>(p);
+    }
+
+    void deallocate(T* p, std::size_t n) noexcept
+    {
+        if (n * sizeof(T) < huge_page_size)
+            aligned_allocator<T>().deallocate(p, n);
+        else
+            ::operator delete(p, std::align_val_t(huge_page_size));
+    }
+
+    template<class U>
+    constexpr bool operator==(const huge_page_allocator<U>&) const noexcept
+    {
+        return true;
+    }
+
+    template<class U>
+    constexpr bool operator!=(const huge_page_allocator<U>&) const noexcept
+    {
+        return false;
+    }
+};
+
+} // namespace safe_float
+} // namespace boost
+
+#endif // BOOST_SAFE_FLOAT_ALLOCATOR_HPP
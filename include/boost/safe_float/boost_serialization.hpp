@@ -0,0 +1,54 @@
+#ifndef BOOST_SAFE_FLOAT_BOOST_SERIALIZATION_HPP
+#define BOOST_SAFE_FLOAT_BOOST_SERIALIZATION_HPP
+
+#include <boost/serialization/nvp.hpp>
+#include <boost/serialization/split_free.hpp>
+
+#include <boost/safe_float.hpp>
+#include <boost/safe_float/detail/charconv.hpp>
+#include <boost/safe_float/detail/ieee754.hpp>
+
+// Boost.Serialization of safe_float, the value is archived as FP and checked when loaded
+namespace boost
+{
+namespace serialization
+{
+template<class ARCHIVE, class FP, template<class T> class CHECK, class ERROR_HANDLING, template<class T> class CAST>
+void save(ARCHIVE& archive, const boost::safe_float::safe_float<FP, CHECK, ERROR_HANDLING, CAST>& value,
+          const unsigned int)
+{
+    FP const stored = value.get_stored_value();
+    archive << boost::serialization::make_nvp("value", stored);
+}
+
+// The loaded value is rejected as the value checks of the operations of CHECK reject results
+template<class ARCHIVE, class FP, template<class T> class CHECK, class ERROR_HANDLING, template<class T> class CAST>
+void load(ARCHIVE& archive, boost::safe_float::safe_float<FP, CHECK, ERROR_HANDLING, CAST>& value, const unsigned int)
+{
+    using checks = boost::safe_float::detail::conversion_checks<FP, CHECK<FP>>;
+    FP stored;
+    archive >> boost::serialization::make_nvp("value", stored);
+    if (BOOST_SAFE_FLOAT_UNLIKELY(!boost::safe_float::detail::is_normal_or_zero(stored)))
+    {
+        ERROR_HANDLING handler;
+        if (checks::invalid && boost::safe_float::detail::is_nan(stored))
+            handler.report_failure("NaN value loaded");
+        else if (checks::overflow && boost::safe_float::detail::is_inf(stored))
+            handler.report_failure("Infinite value loaded");
+        else if (checks::underflow && boost::safe_float::detail::is_subnormal(stored))
+            handler.report_failure("Subnormal value loaded");
+    }
+    value.set_stored_value(stored);
+}
+
+template<class ARCHIVE, class FP, template<class T> class CHECK, class ERROR_HANDLING, template<class T> class CAST>
+void serialize(ARCHIVE& archive, boost::safe_float::safe_float<FP, CHECK, ERROR_HANDLING, CAST>& value,
+               const unsigned int version)
+{
+    boost::serialization::split_free(archive, value, version);
+}
+
+} // namespace serialization
+} // namespace boost
+
+#endif // BOOST_SAFE_FLOAT_BOOST_SERIALIZATION_HPP
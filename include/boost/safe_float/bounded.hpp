@@ -0,0 +1,359 @@
+#ifndef BOOST_SAFE_FLOAT_BOUNDED_HPP
+#define BOOST_SAFE_FLOAT_BOUNDED_HPP
+
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <ratio>
+#include <type_traits>
+
+#include <boost/safe_float.hpp>
+#include <boost/safe_float/detail/check_filter.hpp>
+
+namespace boost
+{
+namespace safe_float
+{
+template<class FP, class LOWEST, class HIGHEST, template<class T> class CHECK, class ERROR_HANDLING>
+class bounded_safe_float;
+
+namespace detail
+{
+// Value of a bound, given as a std::ratio or as a type with a static constexpr long double value
+template<class BOUND>
+struct bound_value
+{
+    static constexpr long double value = BOUND::value;
+};
+
+template<std::intmax_t NUM, std::intmax_t DEN>
+struct bound_value<std::ratio<NUM, DEN>>
+{
+    static constexpr long double value = static_cast<long double>(NUM) / static_cast<long double>(DEN);
+};
+
+struct interval_bounds
+{
+    long double lowest;
+    long double highest;
+};
+
+constexpr bool is_finite_bound(long double bound) noexcept
+{
+    return bound >= -std::numeric_limits<long double>::max() && bound <= std::numeric_limits<long double>::max();
+}
+
+constexpr long double bound_magnitude(long double bound) noexcept { return bound < 0 ? -bound : bound; }
+
+// Distance from a nonnegative value of FP to the next larger one
+template<class FP>
+constexpr long double spacing_above(long double magnitude) noexcept
+{
+    if (magnitude < std::numeric_limits<FP>::min()) return std::numeric_limits<FP>::denorm_min();
+    long double power = 1;
+    while (power * 2 <= magnitude) power *= 2;
+    while (power > magnitude) power /= 2;
+    return power * std::numeric_limits<FP>::epsilon();
+}
+
+// Distance from a positive value of FP to the next smaller one, smaller below the powers of two
+template<class FP>
+constexpr long double spacing_below(long double magnitude) noexcept
+{
+    if (magnitude <= std::numeric_limits<FP>::min()) return std::numeric_limits<FP>::denorm_min();
+    long double const above = spacing_above<FP>(magnitude);
+    long double const power = above / std::numeric_limits<FP>::epsilon();
+    return magnitude == power ? above / 2 : above;
+}
+
+/**
+ * A bound rounded outward to a value of FP, down for the lowest bound and up for the highest one, so the values
+ * of FP in the bounds are the ones the exact bounds hold. A lowest bound below the range of FP is the infinity
+ * of its sign, as a highest one above it is.
+ */
+template<class FP, bool HIGHEST>
+constexpr long double fp_bound(long double bound) noexcept
+{
+    constexpr long double largest = std::numeric_limits<FP>::max();
+    constexpr long double infinity = std::numeric_limits<long double>::infinity();
+    if (std::is_same<FP, long double>::value || !is_finite_bound(bound)) return bound;
+    if (bound > largest) return HIGHEST ? infinity : largest;
+    if (bound < -largest) return HIGHEST ? -largest : -infinity;
+    long double const rounded = static_cast<FP>(bound);
+    if (HIGHEST && rounded < bound)
+        return rounded < 0 ? rounded + spacing_below<FP>(-rounded) : rounded + spacing_above<FP>(rounded);
+    if (!HIGHEST && rounded > bound)
+        return rounded > 0 ? rounded - spacing_below<FP>(rounded) : rounded - spacing_above<FP>(-rounded);
+    return rounded;
+}
+
+constexpr interval_bounds corner_bounds(long double a, long double b, long double c, long double d) noexcept
+{
+    interval_bounds bounds{a, a};
+    for (long double corner : {b, c, d})
+    {
+        if (corner < bounds.lowest) bounds.lowest = corner;
+        if (corner > bounds.highest) bounds.highest = corner;
+    }
+    return bounds;
+}
+
+/**
+ * Bounds of the results of OP applied to values of FP in [l0, l1] and [r0, r1]: the exact bounds computed in long
+ * double, widened by the rounding of the results to FP and of the bounds computed. The results that may be out of
+ * the range of FP have infinite bounds, as the results of operands that may be infinite and of divisors that may
+ * be zero have.
+ */
+template<class FP, class OP>
+constexpr interval_bounds interval_result(long double l0, long double l1, long double r0, long double r1) noexcept
+{
+    constexpr long double infinity = std::numeric_limits<long double>::infinity();
+    if (!is_finite_bound(l0) || !is_finite_bound(l1) || !is_finite_bound(r0) || !is_finite_bound(r1))
+        return {-infinity, infinity};
+
+    constexpr long double largest = std::numeric_limits<FP>::max();
+    constexpr long double limit = std::numeric_limits<long double>::max();
+    // sums and products too large for long double are too large for FP
+    auto const add = [](long double a, long double b) {
+        if (a > 0 && b > 0 && a > limit - b) return infinity;
+        if (a < 0 && b < 0 && a < -limit - b) return -infinity;
+        return a + b;
+    };
+    auto const multiply = [](long double a, long double b) {
+        if (bound_magnitude(a) > 1 && bound_magnitude(b) > limit / bound_magnitude(a))
+            return (a < 0) == (b < 0) ? infinity : -infinity;
+        return a * b;
+    };
+    auto const divide = [](long double a, long double b) {
+        if (bound_magnitude(b) < 1 && bound_magnitude(a) > limit * bound_magnitude(b))
+            return (a < 0) == (b < 0) ? infinity : -infinity;
+        return a / b;
+    };
+
+    interval_bounds bounds{};
+    if constexpr (std::is_same<OP, std::plus<FP>>::value)
+        bounds = {add(l0, r0), add(l1, r1)};
+    else if constexpr (std::is_same<OP, std::minus<FP>>::value)
+        bounds = {add(l0, -r1), add(l1, -r0)};
+    else if constexpr (std::is_same<OP, std::multiplies<FP>>::value)
+        bounds = corner_bounds(multiply(l0, r0), multiply(l0, r1), multiply(l1, r0), multiply(l1, r1));
+    else
+    {
+        if (r0 <= 0 && r1 >= 0) return {-infinity, infinity};
+        bounds = corner_bounds(divide(l0, r0), divide(l0, r1), divide(l1, r0), divide(l1, r1));
+    }
+
+    constexpr long double epsilon = std::numeric_limits<FP>::epsilon();
+    constexpr long double smallest = std::numeric_limits<FP>::denorm_min();
+    long double const below = bound_magnitude(bounds.lowest) * epsilon + smallest;
+    long double const above = bound_magnitude(bounds.highest) * epsilon + smallest;
+    bounds.lowest = bounds.lowest < -largest + below ? -infinity : bounds.lowest - below;
+    bounds.highest = bounds.highest > largest - above ? infinity : bounds.highest + above;
+    return bounds;
+}
+
+// The failures OP may have on values of FP in [L0, L1] and [R0, R1]
+template<class FP, class OP, class L0, class L1, class R0, class R1>
+struct interval_operation
+{
+    static constexpr long double l0 = fp_bound<FP, false>(bound_value<L0>::value);
+    static constexpr long double l1 = fp_bound<FP, true>(bound_value<L1>::value);
+    static constexpr long double r0 = fp_bound<FP, false>(bound_value<R0>::value);
+    static constexpr long double r1 = fp_bound<FP, true>(bound_value<R1>::value);
+
+    static constexpr interval_bounds bounds = interval_result<FP, OP>(l0, l1, r0, r1);
+
+    static constexpr bool is_division = std::is_same<OP, std::divides<FP>>::value;
+    static constexpr bool finite_operands
+        = is_finite_bound(l0) && is_finite_bound(l1) && is_finite_bound(r0) && is_finite_bound(r1);
+    static constexpr bool zero_divisor = is_division && r0 <= 0 && r1 >= 0;
+
+    static constexpr bool may_overflow = !is_finite_bound(bounds.lowest) || !is_finite_bound(bounds.highest);
+    static constexpr bool may_underflow = bounds.lowest < static_cast<long double>(std::numeric_limits<FP>::min())
+                                          && bounds.highest > -static_cast<long double>(std::numeric_limits<FP>::min());
+    static constexpr bool may_be_invalid = !finite_operands || (zero_divisor && l0 <= 0 && l1 >= 0);
+};
+
+// Bound of the results of an interval_operation
+template<class OPERATION, bool HIGHEST>
+struct result_bound
+{
+    static constexpr long double value = HIGHEST ? OPERATION::bounds.highest : OPERATION::bounds.lowest;
+};
+
+/**
+ * The checks of CHECK an operation of bounded values runs: the overflow, underflow, invalid result and division
+ * by zero checks are dropped when the bounds of the operands exclude the failure, the others are kept. The bounds
+ * only hold when ERROR_HANDLING stops the operations that fail, otherwise all the checks are kept.
+ */
+template<class FP, template<class> class CHECK, class ERROR_HANDLING, class OPERATION>
+struct bounded_checks
+{
+    static constexpr unsigned dropped = !stops_on_failure<ERROR_HANDLING>()
+                                            ? 0u
+                                            : (OPERATION::may_overflow ? 0u : overflow_check)
+                                                  | (OPERATION::may_underflow ? 0u : underflow_check)
+                                                  | (OPERATION::may_be_invalid ? 0u : invalid_result_check)
+                                                  | (OPERATION::zero_divisor ? 0u : division_by_zero_check);
+
+    using type = dropped_checks<FP, CHECK, dropped>;
+};
+
+} // namespace detail
+
+/**
+ * A value of FP known to be in [LOWEST, HIGHEST], with its operations checked by the checks of CHECK the bounds
+ * don't prove useless. The bounds are std::ratio types, or types with a static constexpr long double value, they
+ * are rounded outward to values of FP: bounded_safe_float<double, std::ratio<0>, std::ratio<1, 10>> holds 0.1.
+ *
+ * The operations between bounded values give bounded values whose bounds are computed at compile time by
+ * interval arithmetic, widened by the rounding of the results. Their overflow checks are dropped when the bounds
+ * of the result are finite, their underflow checks when the bounds exclude the values smaller than the smallest
+ * normal value, their division by zero checks when the divisor excludes zero and their invalid result checks
+ * unless a zero may be divided by zero. The other checks are kept. Constructing a bounded value out of its
+ * bounds, or assigning it one, is reported to ERROR_HANDLING with the failures of the operations. The checks are
+ * only dropped when ERROR_HANDLING declares it stops the operations that fail, as on_fail_throw does; otherwise
+ * a value out of its bounds is kept, and the operations on it run all the checks of CHECK.
+ */
+template<class FP, class LOWEST, class HIGHEST, template<class T> class CHECK = policy::check_all,
+         class ERROR_HANDLING = policy::on_fail_throw>
+class bounded_safe_float
+{
+    FP number;
+
+    template<class, class, class, template<class> class, class>
+    friend class bounded_safe_float;
+
+    template<class OP, class RHS_LOWEST, class RHS_HIGHEST>
+    using operation = detail::interval_operation<FP, OP, LOWEST, HIGHEST, RHS_LOWEST, RHS_HIGHEST>;
+
+    template<class OP, class RHS_LOWEST, class RHS_HIGHEST>
+    using result = bounded_safe_float<FP, detail::result_bound<operation<OP, RHS_LOWEST, RHS_HIGHEST>, false>,
+                                      detail::result_bound<operation<OP, RHS_LOWEST, RHS_HIGHEST>, true>, CHECK,
+                                      ERROR_HANDLING>;
+
+    template<class OTHER_LOWEST, class OTHER_HIGHEST>
+    static constexpr bool holds_bounds
+        = detail::fp_bound<FP, false>(detail::bound_value<LOWEST>::value)
+              <= detail::fp_bound<FP, false>(detail::bound_value<OTHER_LOWEST>::value)
+          && detail::fp_bound<FP, true>(detail::bound_value<OTHER_HIGHEST>::value)
+                 <= detail::fp_bound<FP, true>(detail::bound_value<HIGHEST>::value);
+
+    struct unchecked
+    {};
+
+    constexpr bounded_safe_float(unchecked, FP value) noexcept : number(value) {}
+
+    static constexpr bool in_bounds(FP value) noexcept { return value >= lowest_bound && value <= highest_bound; }
+
+    BOOST_SAFE_FLOAT_COLD static void report_out_of_bounds()
+    {
+        ERROR_HANDLING handler;
+        handler.report_failure("Value out of bounds");
+    }
+
+    // Checks the value when the bounds it comes from are not in these bounds
+    template<class OTHER_LOWEST, class OTHER_HIGHEST>
+    constexpr void assign_checked(FP value)
+    {
+        if constexpr (!holds_bounds<OTHER_LOWEST, OTHER_HIGHEST>)
+        {
+            if (BOOST_SAFE_FLOAT_UNLIKELY(!in_bounds(value))) report_out_of_bounds();
+        }
+        number = value;
+    }
+
+    template<class OP, class RHS_LOWEST, class RHS_HIGHEST>
+    using checks = typename detail::bounded_checks<FP, CHECK, ERROR_HANDLING,
+                                                  operation<OP, RHS_LOWEST, RHS_HIGHEST>>::type;
+
+    // Applies the operation with the checks the bounds keep, as safe_float applies it with all of them
+    template<class OP, class RHS_LOWEST, class RHS_HIGHEST>
+    static constexpr FP checked_apply(FP lhs, FP rhs)
+        noexcept(detail::nothrow_checked_apply<FP, checks<OP, RHS_LOWEST, RHS_HIGHEST>, ERROR_HANDLING, OP>())
+    {
+        return detail::checked_apply<FP, checks<OP, RHS_LOWEST, RHS_HIGHEST>, ERROR_HANDLING>(lhs, rhs, OP{});
+    }
+
+public:
+    using value_type = FP;
+    using lowest_type = LOWEST;
+    using highest_type = HIGHEST;
+    using report_policy = ERROR_HANDLING;
+
+    // The checks an operation with a right operand bounded by RHS_LOWEST and RHS_HIGHEST runs
+    template<class OP, class RHS_LOWEST = LOWEST, class RHS_HIGHEST = HIGHEST>
+    using operation_checks = checks<OP, RHS_LOWEST, RHS_HIGHEST>;
+
+    // The bounds rounded outward to values of FP, the values are compared with them
+    static constexpr long double lowest_bound = detail::fp_bound<FP, false>(detail::bound_value<LOWEST>::value);
+    static constexpr long double highest_bound = detail::fp_bound<FP, true>(detail::bound_value<HIGHEST>::value);
+
+    static_assert(std::is_floating_point<FP>::value,
+                  "First template parameter in bounded_safe_float has to be floating point data type");
+    static_assert(lowest_bound <= highest_bound, "The lowest bound is larger than the highest bound");
+
+    constexpr explicit bounded_safe_float(FP value) : number(value)
+    {
+        if (BOOST_SAFE_FLOAT_UNLIKELY(!in_bounds(value))) report_out_of_bounds();
+    }
+
+    // Values of narrower bounds convert implicitly and unchecked, the others explicitly with a check
+    template<class OTHER_LOWEST, class OTHER_HIGHEST,
+             std::enable_if_t<holds_bounds<OTHER_LOWEST, OTHER_HIGHEST>, int> = 0>
+    constexpr bounded_safe_float(
+        const bounded_safe_float<FP, OTHER_LOWEST, OTHER_HIGHEST, CHECK, ERROR_HANDLING>& other) noexcept
+        : number(other.number)
+    {}
+
+    template<class OTHER_LOWEST, class OTHER_HIGHEST,
+             std::enable_if_t<!holds_bounds<OTHER_LOWEST, OTHER_HIGHEST>, int> = 0>
+    constexpr explicit bounded_safe_float(
+        const bounded_safe_float<FP, OTHER_LOWEST, OTHER_HIGHEST, CHECK, ERROR_HANDLING>& other)
+        : number(other.number)
+    {
+        if (BOOST_SAFE_FLOAT_UNLIKELY(!in_bounds(number))) report_out_of_bounds();
+    }
+
+    constexpr FP get_stored_value() const noexcept { return number; }
+
+    // The value as a safe_float, its operations check every check of CHECK
+    constexpr safe_float<FP, CHECK, ERROR_HANDLING> to_safe_float() const noexcept
+    {
+        return safe_float<FP, CHECK, ERROR_HANDLING>(number);
+    }
+
+#define BOOST_SAFE_FLOAT_BOUNDED_OPERATION(symbol, OP)                                                            \
+    template<class RHS_LOWEST, class RHS_HIGHEST>                                                                 \
+    constexpr result<OP<FP>, RHS_LOWEST, RHS_HIGHEST> operator symbol(                                            \
+        const bounded_safe_float<FP, RHS_LOWEST, RHS_HIGHEST, CHECK, ERROR_HANDLING>& rhs) const                  \
+        noexcept(noexcept(checked_apply<OP<FP>, RHS_LOWEST, RHS_HIGHEST>(FP(), FP())))                            \
+    {                                                                                                             \
+        return result<OP<FP>, RHS_LOWEST, RHS_HIGHEST>(                                                           \
+            typename result<OP<FP>, RHS_LOWEST, RHS_HIGHEST>::unchecked{},                                        \
+            checked_apply<OP<FP>, RHS_LOWEST, RHS_HIGHEST>(number, rhs.number));                                  \
+    }                                                                                                             \
+                                                                                                                  \
+    /* the result is checked against the bounds when the bounds of the operation are not in them */             \
+    template<class RHS_LOWEST, class RHS_HIGHEST>                                                                 \
+    constexpr bounded_safe_float& operator symbol##=(                                                             \
+        const bounded_safe_float<FP, RHS_LOWEST, RHS_HIGHEST, CHECK, ERROR_HANDLING>& rhs)                        \
+    {                                                                                                             \
+        using operation_type = operation<OP<FP>, RHS_LOWEST, RHS_HIGHEST>;                                        \
+        assign_checked<detail::result_bound<operation_type, false>, detail::result_bound<operation_type, true>>( \
+            checked_apply<OP<FP>, RHS_LOWEST, RHS_HIGHEST>(number, rhs.number));                                  \
+        return *this;                                                                                             \
+    }
+
+    BOOST_SAFE_FLOAT_BOUNDED_OPERATION(+, std::plus)
+    BOOST_SAFE_FLOAT_BOUNDED_OPERATION(-, std::minus)
+    BOOST_SAFE_FLOAT_BOUNDED_OPERATION(*, std::multiplies)
+    BOOST_SAFE_FLOAT_BOUNDED_OPERATION(/, std::divides)
+
+#undef BOOST_SAFE_FLOAT_BOUNDED_OPERATION
+};
+
+} // namespace safe_float
+} // namespace boost
+
+#endif // BOOST_SAFE_FLOAT_BOUNDED_HPP
@@ -0,0 +1,122 @@
+#ifndef BOOST_SAFE_FLOAT_BUFFER_HPP
+#define BOOST_SAFE_FLOAT_BUFFER_HPP
+
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <type_traits>
+
+#if __has_include(<version>)
+#include <version>
+#endif
+#if defined(__cpp_lib_span)
+#include <span>
+#endif
+
+#include <boost/safe_float.hpp>
+
+namespace boost
+{
+namespace safe_float
+{
+/**
+ * True when SF has the layout of its value_type: the policies have no state, it is trivially copyable and
+ * standard layout, so the stored value is at the address of the safe_float and nothing follows it.
+ *
+ * Safe floats only store their value and their report policy, the checks run on a new check policy at each
+ * operation: they are layout compatible when the report policy is stateless, as the ones of the library are.
+ */
+template<class SF>
+struct is_layout_compatible : std::false_type
+{
+};
+
+template<class FP, template<class> class CHECK, class ERROR_HANDLING, template<class> class CAST>
+struct is_layout_compatible<safe_float<FP, CHECK, ERROR_HANDLING, CAST>>
+    : std::bool_constant<std::is_trivially_copyable_v<safe_float<FP, CHECK, ERROR_HANDLING, CAST>>
+                         && std::is_standard_layout_v<safe_float<FP, CHECK, ERROR_HANDLING, CAST>>
+                         && sizeof(safe_float<FP, CHECK, ERROR_HANDLING, CAST>) == sizeof(FP)
+                         && alignof(safe_float<FP, CHECK, ERROR_HANDLING, CAST>) == alignof(FP)>
+{
+};
+
+template<class SF>
+constexpr bool is_layout_compatible_v = is_layout_compatible<SF>::value;
+
+/**
+ * Views count values as safe floats, and a buffer of safe floats as values, without copies.
+ *
+ * A safe float and its value are pointer interconvertible, so a buffer of SF is read as values. The other way
+ * needs SF objects in the storage, SF is an implicit lifetime type. as_safe on writable values starts the
+ * lifetime of count SF objects holding the values, with std::start_lifetime_as_array when the library
+ * provides it, by moving the bytes in place otherwise, which implicitly creates the objects.
+ *
+ * The values viewed through the const overload can't be written, without std::start_lifetime_as_array the
+ * storage must already hold SF objects: storage obtained as bytes from an allocation function or mmap, or
+ * filled by memcpy or a read from a file or a socket. Values created as FP objects, by new FP[] or a FP array,
+ * are viewed by the overload for writable values first.
+ */
+template<class SF>
+SF* as_safe(typename SF::value_type* data, std::size_t count) noexcept
+{
+    static_assert(is_layout_compatible_v<SF>, "The safe_float type needs a stateless report policy to view values");
+#if defined(__cpp_lib_start_lifetime_as)
+    return std::start_lifetime_as_array<SF>(data, count);
+#else
+    return std::launder(static_cast<SF*>(std::memmove(data, data, count * sizeof(SF))));
+#endif
+}
+
+template<class SF>
+const SF* as_safe(const typename SF::value_type* data, std::size_t count) noexcept
+{
+    static_assert(is_layout_compatible_v<SF>, "The safe_float type needs a stateless report policy to view values");
+#if defined(__cpp_lib_start_lifetime_as)
+    return std::start_lifetime_as_array<SF>(data, count);
+#else
+    static_cast<void>(count);
+    return std::launder(reinterpret_cast<const SF*>(data));
+#endif
+}
+
+template<class SF, std::enable_if_t<is_safe_float<SF>::value, int> = 0>
+typename SF::value_type* as_raw(SF* data) noexcept
+{
+    static_assert(is_layout_compatible_v<SF>, "The safe_float type needs a stateless report policy to be viewed as values");
+    return reinterpret_cast<typename SF::value_type*>(data);
+}
+
+template<class SF, std::enable_if_t<is_safe_float<SF>::value, int> = 0>
+const typename SF::value_type* as_raw(const SF* data) noexcept
+{
+    static_assert(is_layout_compatible_v<SF>, "The safe_float type needs a stateless report policy to be viewed as values");
+    return reinterpret_cast<const typename SF::value_type*>(data);
+}
+
+#if defined(__cpp_lib_span)
+template<class SF, std::size_t EXTENT>
+std::span<SF, EXTENT> as_safe(std::span<typename SF::value_type, EXTENT> values) noexcept
+{
+    return std::span<SF, EXTENT>(as_safe<SF>(values.data(), values.size()), values.size());
+}
+
+template<class SF, std::size_t EXTENT>
+std::span<const SF, EXTENT> as_safe(std::span<const typename SF::value_type, EXTENT> values) noexcept
+{
+    return std::span<const SF, EXTENT>(as_safe<SF>(values.data(), values.size()), values.size());
+}
+
+template<class SF, std::size_t EXTENT, std::enable_if_t<is_safe_float<std::remove_const_t<SF>>::value, int> = 0>
+auto as_raw(std::span<SF, EXTENT> values) noexcept
+{
+    using value_type = std::conditional_t<std::is_const_v<SF>, const typename std::remove_const_t<SF>::value_type,
+                                          typename SF::value_type>;
+    return std::span<value_type, EXTENT>(as_raw(values.data()), values.size());
+}
+#endif
+
+} // namespace safe_float
+} // namespace boost
+
+#endif // BOOST_SAFE_FLOAT_BUFFER_HPP
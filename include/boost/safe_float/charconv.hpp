@@ -0,0 +1,166 @@
+#ifndef BOOST_SAFE_FLOAT_CHARCONV_HPP
+#define BOOST_SAFE_FLOAT_CHARCONV_HPP
+
+#include <charconv>
+#include <cstddef>
+#include <system_error>
+
+#if __has_include(<version>)
+#include <version>
+#endif
+#if defined(__cpp_lib_format)
+#include <format>
+#endif
+
+#include <boost/safe_float.hpp>
+#include <boost/safe_float/detail/charconv.hpp>
+
+namespace boost
+{
+namespace safe_float
+{
+/**
+ * Converts the characters in [first, last) as std::from_chars does and checks the conversion as the arithmetic
+ * operations are checked: a number too large for FP is an overflow, a nonzero number converted to a subnormal
+ * value or to zero an underflow, a number that has no exact representation an inexact conversion and "nan" an
+ * invalid result. The failures are reported when CHECK holds a check of an operation for them.
+ *
+ * Unlike std::from_chars, a number out of range is stored as the infinity or the zero the operations give, and
+ * std::errc::result_out_of_range is returned. Nothing is stored when the characters don't start with a number.
+ */
+template<class FP, template<class T> class CHECK, class ERROR_HANDLING, template<class T> class CAST>
+std::from_chars_result from_chars(const char* first, const char* last,
+                                  safe_float<FP, CHECK, ERROR_HANDLING, CAST>& value,
+                                  std::chars_format format = std::chars_format::general)
+{
+    FP number;
+    std::from_chars_result const result
+        = detail::checked_from_chars<FP, CHECK<FP>, ERROR_HANDLING>(first, last, number, format);
+    if (result.ec != std::errc::invalid_argument) value.set_stored_value(number);
+    return result;
+}
+
+// Position after the numbers parsed, their count, and the error of the first number that failed
+struct parse_many_result
+{
+    const char* ptr;
+    std::size_t count;
+    std::errc ec;
+};
+
+/**
+ * Parses the numbers in [first, last) separated by separator or by blanks, as lines of CSV files are, and writes
+ * them to out as values of SF. Parsing stops at the end of the characters or at the first field that is not a
+ * number, whose position is returned with std::errc::invalid_argument. Numbers out of range are written as
+ * from_chars stores them and the parsing goes on, std::errc::result_out_of_range is returned at the end.
+ */
+template<class SF, class OUTPUT>
+parse_many_result parse_many(const char* first, const char* last, OUTPUT out, char separator = ',',
+                             std::chars_format format = std::chars_format::general)
+{
+    static_assert(is_safe_float<SF>::value, "Numbers are parsed to safe_float values");
+    auto const blank = [](char c) { return c == ' ' || c == '\t' || c == '\r' || c == '\n'; };
+    parse_many_result parsed{first, 0, std::errc()};
+    for (;;)
+    {
+        while (first != last && blank(*first)) ++first;
+        parsed.ptr = first;
+        if (first == last) return parsed;
+
+        SF value;
+        std::from_chars_result const result = from_chars(first, last, value, format);
+        if (result.ec == std::errc::invalid_argument
+            || (result.ptr != last && *result.ptr != separator && !blank(*result.ptr)))
+        {
+            parsed.ec = std::errc::invalid_argument;
+            return parsed;
+        }
+        if (result.ec != std::errc()) parsed.ec = result.ec;
+        *out = value;
+        ++out;
+        ++parsed.count;
+
+        first = result.ptr;
+        while (first != last && (*first == ' ' || *first == '\t')) ++first;
+        if (first != last && *first == separator) ++first;
+    }
+}
+
+/**
+ * Writes the shortest characters converted back to the same value, as std::to_chars does. The value is written
+ * as it is stored, formatting checks nothing.
+ */
+template<class FP, template<class T> class CHECK, class ERROR_HANDLING, template<class T> class CAST>
+std::to_chars_result to_chars(char* first, char* last, const safe_float<FP, CHECK, ERROR_HANDLING, CAST>& value)
+{
+    return std::to_chars(first, last, value.get_stored_value());
+}
+
+template<class FP, template<class T> class CHECK, class ERROR_HANDLING, template<class T> class CAST>
+std::to_chars_result to_chars(char* first, char* last, const safe_float<FP, CHECK, ERROR_HANDLING, CAST>& value,
+                              std::chars_format format)
+{
+    return std::to_chars(first, last, value.get_stored_value(), format);
+}
+
+template<class FP, template<class T> class CHECK, class ERROR_HANDLING, template<class T> class CAST>
+std::to_chars_result to_chars(char* first, char* last, const safe_float<FP, CHECK, ERROR_HANDLING, CAST>& value,
+                              std::chars_format format, int precision)
+{
+    return std::to_chars(first, last, value.get_stored_value(), format, precision);
+}
+
+// Position after the characters written, the number of values written, and std::errc::value_too_large when
+// the buffer is too small for all of them
+struct format_many_result
+{
+    char* ptr;
+    std::size_t count;
+    std::errc ec;
+};
+
+/**
+ * Writes the values in [values, values_end) to the buffer [first, last) in the shortest characters converted
+ * back to them, followed each by separator. Writing stops at the first value that doesn't fit with its separator,
+ * the buffer then holds the values before it.
+ */
+template<class INPUT>
+format_many_result format_many(char* first, char* last, INPUT values, INPUT values_end, char separator = ',')
+{
+    format_many_result written{first, 0, std::errc()};
+    for (; values != values_end; ++values)
+    {
+        std::to_chars_result const result = to_chars(written.ptr, last, *values);
+        if (result.ec != std::errc() || result.ptr == last)
+        {
+            written.ec = std::errc::value_too_large;
+            return written;
+        }
+        *result.ptr = separator;
+        written.ptr = result.ptr + 1;
+        ++written.count;
+    }
+    return written;
+}
+
+} // namespace safe_float
+} // namespace boost
+
+#if defined(__cpp_lib_format)
+namespace std
+{
+// Formats the stored value with the format specifications of FP
+template<class FP, template<class T> class CHECK, class ERROR_HANDLING, template<class T> class CAST>
+struct formatter<boost::safe_float::safe_float<FP, CHECK, ERROR_HANDLING, CAST>, char> : formatter<FP, char>
+{
+    template<class FORMAT_CONTEXT>
+    auto format(const boost::safe_float::safe_float<FP, CHECK, ERROR_HANDLING, CAST>& value,
+                FORMAT_CONTEXT& context) const
+    {
+        return formatter<FP, char>::format(value.get_stored_value(), context);
+    }
+};
+} // namespace std
+#endif
+
+#endif // BOOST_SAFE_FLOAT_CHARCONV_HPP
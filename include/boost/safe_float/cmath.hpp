@@ -0,0 +1,254 @@
+#ifndef BOOST_SAFE_FLOAT_CMATH_HPP
+#define BOOST_SAFE_FLOAT_CMATH_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include <boost/safe_float.hpp>
+#include <boost/safe_float/detail/check_filter.hpp>
+
+namespace boost
+{
+namespace safe_float
+{
+namespace detail
+{
+template<class FP, class POLICY, class = void>
+struct has_pre_function_check : std::false_type
+{};
+
+template<class FP, class POLICY>
+struct has_pre_function_check<FP, POLICY,
+                              std::void_t<decltype(std::declval<POLICY&>().pre_function_check(
+                                  policy::math_function{}, std::declval<const FP&>(), std::declval<const FP&>()))>>
+    : std::true_type
+{};
+
+template<class FP, class POLICY, class = void>
+struct has_post_function_check : std::false_type
+{};
+
+template<class FP, class POLICY>
+struct has_post_function_check<FP, POLICY,
+                               std::void_t<decltype(std::declval<POLICY&>().post_function_check(
+                                   policy::math_function{}, std::declval<const FP&>(), std::declval<const FP&>(),
+                                   std::declval<const FP&>()))>> : std::true_type
+{};
+
+/**
+ * The function checks of the policies composed in a check policy, the policies checking the operators only are
+ * skipped. The checks hold no state between the arguments and the result, each check runs on a new policy.
+ */
+template<class FP, class ERROR_HANDLING, class FLAT>
+struct function_checks;
+
+template<class FP, class ERROR_HANDLING, template<class> class... CHECKS>
+struct function_checks<FP, ERROR_HANDLING, policy::flattened<CHECKS...>>
+{
+    static constexpr bool checks_any = ((has_pre_function_check<FP, CHECKS<FP>>::value
+                                         || has_post_function_check<FP, CHECKS<FP>>::value)
+                                        || ... || false);
+
+    static constexpr bool nothrow
+        = !checks_any || noexcept(std::declval<ERROR_HANDLING&>().report_failure(std::declval<const std::string&>()));
+
+    template<class POLICY>
+    static bool pre_check(policy::math_function f, FP x, FP y) noexcept
+    {
+        if constexpr (has_pre_function_check<FP, POLICY>::value)
+            return POLICY{}.pre_function_check(f, x, y);
+        else
+            return true;
+    }
+
+    template<class POLICY>
+    static bool post_check(policy::math_function f, FP x, FP y, FP value) noexcept
+    {
+        if constexpr (has_post_function_check<FP, POLICY>::value)
+            return POLICY{}.post_function_check(f, x, y, value);
+        else
+            return true;
+    }
+
+    static bool pre(policy::math_function f, FP x, FP y) noexcept
+    {
+        return (pre_check<CHECKS<FP>>(f, x, y) && ... && true);
+    }
+
+    static bool post(policy::math_function f, FP x, FP y, FP value) noexcept
+    {
+        return (post_check<CHECKS<FP>>(f, x, y, value) && ... && true);
+    }
+
+    // The checks are run again one by one to report the message of each failing one
+    BOOST_SAFE_FLOAT_COLD static void report_pre(policy::math_function f, FP x, FP y) noexcept(nothrow)
+    {
+        ERROR_HANDLING handler{};
+        ((pre_check<CHECKS<FP>>(f, x, y) ? void() : handler.report_failure(CHECKS<FP>{}.function_failure_message(f))),
+         ...);
+    }
+
+    BOOST_SAFE_FLOAT_COLD static void report_post(policy::math_function f, FP x, FP y, FP value) noexcept(nothrow)
+    {
+        ERROR_HANDLING handler{};
+        ((post_check<CHECKS<FP>>(f, x, y, value)
+              ? void()
+              : handler.report_failure(CHECKS<FP>{}.function_failure_message(f))),
+         ...);
+    }
+};
+
+// FLAT with CHECK appended when the kinds of the checks of the operators in FLAT hold KIND and CHECK is not in it
+template<class FLAT, unsigned KIND, template<class> class CHECK>
+struct implied_check;
+
+template<template<class> class... CHECKS, unsigned KIND, template<class> class CHECK>
+struct implied_check<policy::flattened<CHECKS...>, KIND, CHECK>
+{
+    static constexpr bool implied = ((check_kind_of<CHECKS>() | ... | 0u) & KIND) != 0
+                                    && !(policy::is_same_template<CHECK, CHECKS>::value || ... || false);
+    using type = std::conditional_t<implied, policy::flattened<CHECKS..., CHECK>, policy::flattened<CHECKS...>>;
+};
+
+/**
+ * The checks of the functions the checks of the operators imply: the overflow checks imply the range overflow
+ * check, the underflow checks the range underflow check, the invalid result checks the domain error check, and
+ * the division by zero check the pole error check. Implied checks already composed are not added again.
+ */
+template<class FLAT>
+struct implied_function_checks
+{
+    using with_overflow = typename implied_check<FLAT, overflow_check, policy::check_range_overflow>::type;
+    using with_underflow = typename implied_check<with_overflow, underflow_check, policy::check_range_underflow>::type;
+    using with_domain = typename implied_check<with_underflow, invalid_result_check, policy::check_domain_error>::type;
+    using type = typename implied_check<with_domain, division_by_zero_check, policy::check_pole_error>::type;
+};
+
+template<class FP, template<class> class CHECK, class ERROR_HANDLING>
+using function_checks_of = function_checks<
+    FP, ERROR_HANDLING,
+    typename implied_function_checks<typename dropped_checks_of<FP, CHECK, other_check>::leaves>::type>;
+
+// The arguments out of the domain are rejected before the function is computed, when the failures stop it.
+// Otherwise the result of rejected arguments is not checked, its failure is already reported
+template<class FP, class CHECKS, class FUNCTION>
+FP checked_function(policy::math_function f, FP x, FP y, FUNCTION function) noexcept(CHECKS::nothrow)
+{
+    bool const accepted = CHECKS::pre(f, x, y);
+    if (BOOST_SAFE_FLOAT_UNLIKELY(!accepted)) CHECKS::report_pre(f, x, y);
+    FP const value = function(x, y);
+    if (BOOST_SAFE_FLOAT_UNLIKELY(accepted && !CHECKS::post(f, x, y, value))) CHECKS::report_post(f, x, y, value);
+    return value;
+}
+
+/**
+ * Applies the function to count arguments, and to the second arguments y when they are given, in blocks. The
+ * pre checks of a block run first, then the function is computed by a loop without branches the compiler
+ * vectorizes when a vector math library is available, then the results are checked. When a check of the block
+ * fails, the block is computed again one element at a time and each failure is reported as the loop of scalar
+ * calls would. The results may be written over the arguments.
+ */
+template<class FP, class CHECKS, class SF, class FUNCTION>
+void checked_function_n(policy::math_function f, const SF* x, const SF* y, std::size_t count, SF* result,
+                        FUNCTION function) noexcept(CHECKS::nothrow)
+{
+    constexpr std::size_t block_size = 256;
+    FP xs[block_size];
+    FP ys[block_size];
+    FP values[block_size];
+    for (std::size_t first = 0; first < count; first += block_size)
+    {
+        std::size_t const n = std::min(block_size, count - first);
+        for (std::size_t i = 0; i != n; ++i) xs[i] = x[first + i].get_stored_value();
+        if (y)
+            for (std::size_t i = 0; i != n; ++i) ys[i] = y[first + i].get_stored_value();
+        else
+            std::fill_n(ys, n, FP(0));
+        bool valid = true;
+        for (std::size_t i = 0; i != n; ++i) valid &= CHECKS::pre(f, xs[i], ys[i]);
+        if (BOOST_SAFE_FLOAT_LIKELY(valid))
+        {
+            for (std::size_t i = 0; i != n; ++i) values[i] = function(xs[i], ys[i]);
+            for (std::size_t i = 0; i != n; ++i) valid &= CHECKS::post(f, xs[i], ys[i], values[i]);
+        }
+        if (BOOST_SAFE_FLOAT_UNLIKELY(!valid))
+            for (std::size_t i = 0; i != n; ++i)
+                values[i] = checked_function<FP, CHECKS>(f, xs[i], ys[i], function);
+        for (std::size_t i = 0; i != n; ++i) result[first + i].set_stored_value(values[i]);
+    }
+}
+} // namespace detail
+
+/**
+ * Checked overloads of the <cmath> functions. The function checks of CHECK, check_domain_error,
+ * check_pole_error, check_range_overflow, check_range_underflow and check_function_inexact, run on the
+ * arguments before the function is computed and on the result after, their failures are reported to
+ * ERROR_HANDLING. The overflow, underflow, invalid result and division by zero checks of the operators in CHECK
+ * imply check_range_overflow, check_range_underflow, check_domain_error and check_pole_error on the functions; the
+ * other checks of the operators don't apply to them.
+ *
+ * The functions named with _n apply the function to count safe floats, and to the second arguments of the
+ * binary functions, and write count results.
+ */
+#define BOOST_SAFE_FLOAT_UNARY_FUNCTION(name)                                                                       \
+    template<class FP, template<class> class CHECK, class ERROR_HANDLING, template<class> class CAST>               \
+    safe_float<FP, CHECK, ERROR_HANDLING, CAST> name(const safe_float<FP, CHECK, ERROR_HANDLING, CAST>& x) noexcept( \
+        detail::function_checks_of<FP, CHECK, ERROR_HANDLING>::nothrow)                                             \
+    {                                                                                                               \
+        safe_float<FP, CHECK, ERROR_HANDLING, CAST> result;                                                         \
+        result.set_stored_value(detail::checked_function<FP, detail::function_checks_of<FP, CHECK, ERROR_HANDLING>>( \
+            policy::math_function::name, x.get_stored_value(), FP(0), [](FP value, FP) { return std::name(value); })); \
+        return result;                                                                                              \
+    }                                                                                                               \
+                                                                                                                    \
+    template<class FP, template<class> class CHECK, class ERROR_HANDLING, template<class> class CAST>               \
+    void name##_n(const safe_float<FP, CHECK, ERROR_HANDLING, CAST>* x, std::size_t count,                         \
+                  safe_float<FP, CHECK, ERROR_HANDLING, CAST>* result) noexcept(                                   \
+        detail::function_checks_of<FP, CHECK, ERROR_HANDLING>::nothrow)                                             \
+    {                                                                                                               \
+        detail::checked_function_n<FP, detail::function_checks_of<FP, CHECK, ERROR_HANDLING>>(                      \
+            policy::math_function::name, x, static_cast<decltype(x)>(nullptr), count, result,                       \
+            [](FP value, FP) { return std::name(value); });                                                         \
+    }
+
+#define BOOST_SAFE_FLOAT_BINARY_FUNCTION(name)                                                                      \
+    template<class FP, template<class> class CHECK, class ERROR_HANDLING, template<class> class CAST>               \
+    safe_float<FP, CHECK, ERROR_HANDLING, CAST> name(const safe_float<FP, CHECK, ERROR_HANDLING, CAST>& x,          \
+                                                     const safe_float<FP, CHECK, ERROR_HANDLING, CAST>& y) noexcept( \
+        detail::function_checks_of<FP, CHECK, ERROR_HANDLING>::nothrow)                                             \
+    {                                                                                                               \
+        safe_float<FP, CHECK, ERROR_HANDLING, CAST> result;                                                         \
+        result.set_stored_value(detail::checked_function<FP, detail::function_checks_of<FP, CHECK, ERROR_HANDLING>>( \
+            policy::math_function::name, x.get_stored_value(), y.get_stored_value(),                                \
+            [](FP lhs, FP rhs) { return std::name(lhs, rhs); }));                                                   \
+        return result;                                                                                              \
+    }                                                                                                               \
+                                                                                                                    \
+    template<class FP, template<class> class CHECK, class ERROR_HANDLING, template<class> class CAST>               \
+    void name##_n(const safe_float<FP, CHECK, ERROR_HANDLING, CAST>* x,                                            \
+                  const safe_float<FP, CHECK, ERROR_HANDLING, CAST>* y, std::size_t count,                         \
+                  safe_float<FP, CHECK, ERROR_HANDLING, CAST>* result) noexcept(                                   \
+        detail::function_checks_of<FP, CHECK, ERROR_HANDLING>::nothrow)                                             \
+    {                                                                                                               \
+        detail::checked_function_n<FP, detail::function_checks_of<FP, CHECK, ERROR_HANDLING>>(                      \
+            policy::math_function::name, x, y, count, result, [](FP lhs, FP rhs) { return std::name(lhs, rhs); }); \
+    }
+
+BOOST_SAFE_FLOAT_UNARY_FUNCTION(sqrt)
+BOOST_SAFE_FLOAT_UNARY_FUNCTION(exp)
+BOOST_SAFE_FLOAT_UNARY_FUNCTION(log)
+BOOST_SAFE_FLOAT_BINARY_FUNCTION(pow)
+BOOST_SAFE_FLOAT_BINARY_FUNCTION(hypot)
+BOOST_SAFE_FLOAT_BINARY_FUNCTION(atan2)
+
+#undef BOOST_SAFE_FLOAT_UNARY_FUNCTION
+#undef BOOST_SAFE_FLOAT_BINARY_FUNCTION
+
+} // namespace safe_float
+} // namespace boost
+
+#endif // BOOST_SAFE_FLOAT_CMATH_HPP
@@ -0,0 +1,307 @@
+#ifndef BOOST_SAFE_FLOAT_COLUMN_FILE_HPP
+#define BOOST_SAFE_FLOAT_COLUMN_FILE_HPP
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <vector>
+
+#include <boost/safe_float/buffer.hpp>
+#include <boost/safe_float/serialization.hpp>
+#include <boost/safe_float/validator.hpp>
+
+namespace boost
+{
+namespace safe_float
+{
+// Values of a block of a column file written by default
+constexpr std::size_t default_column_block = std::size_t(1) << 16;
+
+/**
+ * Statistics of a block of a column file: the smallest and largest values other than NaN, lowest > highest
+ * when there is none, the number of values of each kind the policies reject, and the identity of the check
+ * policy of the writer.
+ */
+template<class FP>
+struct column_block
+{
+    FP lowest;
+    FP highest;
+    std::uint64_t policy;
+    std::uint32_t values;
+    std::uint32_t nan_count;
+    std::uint32_t infinite_count;
+    std::uint32_t subnormal_count;
+};
+
+namespace detail
+{
+// Header of a column file, the values follow it and the statistics of the blocks follow the values
+struct column_header
+{
+    char magic[8];
+    std::uint32_t value_size;
+    std::uint32_t value_digits;
+    std::uint64_t count;
+    std::uint64_t block_values;
+    std::uint64_t blocks;
+    std::uint64_t statistics_offset;
+    std::uint64_t reserved[2];
+};
+
+constexpr char column_magic[8] = {'S', 'F', 'C', 'O', 'L', 'U', 'M', '1'};
+
+// The values and the statistics start at multiples of this offset, aligned for every type in mapped files
+constexpr std::size_t column_alignment = 64;
+
+static_assert(sizeof(column_header) == column_alignment, "The values follow the header");
+
+// Statistics of a block, computed with the kernels of the validation
+template<class FP>
+column_block<FP> block_statistics(const FP* values, std::size_t n, std::uint64_t policy) noexcept
+{
+    column_block<FP> block{};
+    value_bounds(values, 0, n, block.lowest, block.highest);
+    validation_report report;
+    scan_values(values, 0, n, value_range<FP>(), report);
+    block.policy = policy;
+    block.values = static_cast<std::uint32_t>(n);
+    block.nan_count = static_cast<std::uint32_t>(report.nan.count);
+    block.infinite_count = static_cast<std::uint32_t>(report.infinite.count);
+    block.subnormal_count = static_cast<std::uint32_t>(report.subnormal.count);
+    return block;
+}
+
+template<class FP>
+column_block<FP> little_endian(column_block<FP> block) noexcept
+{
+    block.lowest = little_endian(block.lowest);
+    block.highest = little_endian(block.highest);
+    block.policy = little_endian(block.policy);
+    block.values = little_endian(block.values);
+    block.nan_count = little_endian(block.nan_count);
+    block.infinite_count = little_endian(block.infinite_count);
+    block.subnormal_count = little_endian(block.subnormal_count);
+    return block;
+}
+
+} // namespace detail
+
+/**
+ * Writes a column of values of SF in blocks of a fixed number of values, the statistics of each block are
+ * computed as the block is written and follow the values. Throws std::system_error when the file can't be
+ * written.
+ */
+template<class SF>
+class column_writer
+{
+    using FP = typename SF::value_type;
+    static constexpr std::uint64_t policy = detail::policy_identity<FP, typename SF::check_policy>();
+
+    std::string path;
+    std::ofstream file;
+    std::size_t block_values;
+    std::vector<FP> pending;
+    std::vector<column_block<FP>> blocks;
+    std::uint64_t count = 0;
+    bool open = true;
+
+    void check(const std::ostream& out) const
+    {
+        if (!out) throw std::system_error(errno, std::generic_category(), path);
+    }
+
+    void write_block()
+    {
+        blocks.push_back(detail::little_endian(detail::block_statistics(pending.data(), pending.size(), policy)));
+        for (FP& value : pending) value = detail::little_endian(value);
+        file.write(reinterpret_cast<const char*>(pending.data()),
+                   static_cast<std::streamsize>(pending.size() * sizeof(FP)));
+        check(file);
+        count += pending.size();
+        pending.clear();
+    }
+
+public:
+    static_assert(is_safe_float<SF>::value, "Columns hold safe_float values");
+
+    explicit column_writer(const std::string& path, std::size_t block_values = default_column_block)
+        : path(path), file(path, std::ios::binary | std::ios::trunc), block_values(block_values)
+    {
+        if (block_values == 0 || block_values > std::numeric_limits<std::uint32_t>::max())
+            throw std::invalid_argument("The blocks of a column hold from 1 to 2^32 - 1 values");
+        check(file);
+        detail::column_header const header{};
+        file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        check(file);
+        pending.reserve(block_values);
+    }
+
+    column_writer(const column_writer&) = delete;
+    column_writer& operator=(const column_writer&) = delete;
+
+    // Closes the file when close wasn't called, failures are lost
+    ~column_writer()
+    {
+        try
+        {
+            if (open) close();
+        }
+        catch (...)
+        {
+        }
+    }
+
+    void append(const SF* values, std::size_t n)
+    {
+        for (std::size_t i = 0; i != n; ++i)
+        {
+            pending.push_back(values[i].get_stored_value());
+            if (pending.size() == block_values) write_block();
+        }
+    }
+
+    void append(const SF& value) { append(&value, 1); }
+
+    // Writes the last block, the statistics and the header
+    void close()
+    {
+        open = false;
+        if (!pending.empty()) write_block();
+        std::uint64_t const values_end = sizeof(detail::column_header) + count * sizeof(FP);
+        std::uint64_t const statistics_offset
+            = (values_end + detail::column_alignment - 1) / detail::column_alignment * detail::column_alignment;
+        static char const padding[detail::column_alignment] = {};
+        file.write(padding, static_cast<std::streamsize>(statistics_offset - values_end));
+        file.write(reinterpret_cast<const char*>(blocks.data()),
+                   static_cast<std::streamsize>(blocks.size() * sizeof(column_block<FP>)));
+
+        detail::column_header header{};
+        std::memcpy(header.magic, detail::column_magic, sizeof(header.magic));
+        header.value_size = detail::little_endian(std::uint32_t(sizeof(FP)));
+        header.value_digits = detail::little_endian(std::uint32_t(std::numeric_limits<FP>::digits));
+        header.count = detail::little_endian(count);
+        header.block_values = detail::little_endian(std::uint64_t(block_values));
+        header.blocks = detail::little_endian(std::uint64_t(blocks.size()));
+        header.statistics_offset = detail::little_endian(statistics_offset);
+        file.seekp(0);
+        file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        file.close();
+        check(file);
+    }
+};
+
+/**
+ * A column file mapped in memory, its values are read in place as values of SF without deserialization. Opening
+ * the file reports the NaN, infinite and subnormal values of the blocks the check policy of SF rejects, from the
+ * statistics of the blocks, whatever the policy of their writer. Throws std::system_error when the file can't be
+ * read, and std::invalid_argument when it doesn't hold a column of values of the value type of SF.
+ */
+template<class SF>
+class column_file
+{
+    using FP = typename SF::value_type;
+
+    detail::mapped_file file;
+    detail::column_header header;
+    const column_block<FP>* statistics;
+
+    const unsigned char* bytes() const noexcept { return static_cast<const unsigned char*>(file.data()); }
+
+    BOOST_SAFE_FLOAT_COLD void report_blocks(std::uint64_t nan_count, std::uint64_t infinite_count,
+                                             std::uint64_t subnormal_count, std::size_t first_block) const
+    {
+        using checks = detail::conversion_checks<FP, typename SF::check_policy>;
+        typename SF::report_policy handler;
+        auto const report = [&](std::uint64_t count, const char* kind) {
+            if (count)
+                handler.report_failure(std::to_string(count) + " " + kind + " values in column, the first in block "
+                                       + std::to_string(first_block));
+        };
+        if (checks::invalid) report(nan_count, "NaN");
+        if (checks::overflow) report(infinite_count, "infinite");
+        if (checks::underflow) report(subnormal_count, "subnormal");
+    }
+
+public:
+    static_assert(is_layout_compatible_v<SF>, "The safe_float type needs a stateless report policy to view values");
+    static_assert(detail::little_endian_host(), "Column files are mapped on little endian hosts");
+
+    explicit column_file(const std::string& path) : file(path)
+    {
+        if (file.size() < sizeof(header)) throw std::invalid_argument(path + " doesn't hold a column");
+        std::memcpy(&header, bytes(), sizeof(header));
+        if (std::memcmp(header.magic, detail::column_magic, sizeof(header.magic)) != 0)
+            throw std::invalid_argument(path + " doesn't hold a column");
+        if (header.value_size != sizeof(FP) || header.value_digits != std::uint32_t(std::numeric_limits<FP>::digits))
+            throw std::invalid_argument(path + " doesn't hold a column of the type read");
+        // the sizes are bounded by the size of the file before they are multiplied
+        std::uint64_t const value_capacity = (file.size() - sizeof(header)) / sizeof(FP);
+        if (header.block_values == 0 || header.block_values > std::numeric_limits<std::uint32_t>::max()
+            || header.count > value_capacity
+            || header.blocks != header.count / header.block_values + (header.count % header.block_values != 0)
+            || header.statistics_offset < sizeof(header) + header.count * sizeof(FP)
+            || header.statistics_offset % detail::column_alignment != 0 || header.statistics_offset > file.size()
+            || header.blocks > (file.size() - header.statistics_offset) / sizeof(column_block<FP>))
+            throw std::invalid_argument(path + " holds a truncated column");
+        statistics = reinterpret_cast<const column_block<FP>*>(bytes() + header.statistics_offset);
+
+        // every block but the last is full, the counts of the values rejected are within the block
+        std::uint64_t nan_count = 0, infinite_count = 0, subnormal_count = 0;
+        std::size_t first_block = 0;
+        for (std::size_t b = 0; b != block_count(); ++b)
+        {
+            const column_block<FP>& stats = statistics[b];
+            if (stats.values != std::min<std::uint64_t>(header.block_values, header.count - b * header.block_values)
+                || std::uint64_t(stats.nan_count) + stats.infinite_count + stats.subnormal_count > stats.values)
+                throw std::invalid_argument(path + " holds corrupted statistics");
+            if (!nan_count && !infinite_count && !subnormal_count) first_block = b;
+            nan_count += stats.nan_count;
+            infinite_count += stats.infinite_count;
+            subnormal_count += stats.subnormal_count;
+        }
+        if (BOOST_SAFE_FLOAT_UNLIKELY(nan_count || infinite_count || subnormal_count))
+            report_blocks(nan_count, infinite_count, subnormal_count, first_block);
+    }
+
+    std::size_t size() const noexcept { return static_cast<std::size_t>(header.count); }
+    std::size_t block_count() const noexcept { return static_cast<std::size_t>(header.blocks); }
+    std::size_t block_values() const noexcept { return static_cast<std::size_t>(header.block_values); }
+
+    const SF* values() const noexcept
+    {
+        return as_safe<SF>(reinterpret_cast<const FP*>(bytes() + sizeof(header)), size());
+    }
+    const column_block<FP>& block(std::size_t b) const noexcept { return statistics[b]; }
+    const SF* block_data(std::size_t b) const noexcept { return values() + b * block_values(); }
+    std::size_t block_size(std::size_t b) const noexcept { return statistics[b].values; }
+
+    // Blocks whose statistics satisfy the predicate, the values of the others are not read
+    template<class PREDICATE>
+    std::vector<std::size_t> select_blocks(PREDICATE predicate) const
+    {
+        std::vector<std::size_t> selected;
+        for (std::size_t b = 0; b != block_count(); ++b)
+            if (predicate(statistics[b])) selected.push_back(b);
+        return selected;
+    }
+
+    // Blocks that may hold values in [lowest, highest]
+    std::vector<std::size_t> blocks_in_range(FP lowest, FP highest) const
+    {
+        return select_blocks([lowest, highest](const column_block<FP>& block) {
+            return block.lowest <= highest && block.highest >= lowest;
+        });
+    }
+};
+
+} // namespace safe_float
+} // namespace boost
+
+#endif // BOOST_SAFE_FLOAT_COLUMN_FILE_HPP
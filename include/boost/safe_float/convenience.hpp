@@ -41,6 +41,15 @@
 
 #include <boost/safe_float/policy/check_division_by_zero.hpp>
 
+#include <boost/safe_float/policy/check_flush_to_zero.hpp>
+#include <boost/safe_float/policy/check_subnormal_operand.hpp>
+
+#include <boost/safe_float/policy/check_domain_error.hpp>
+#include <boost/safe_float/policy/check_pole_error.hpp>
+#include <boost/safe_float/policy/check_range_overflow.hpp>
+#include <boost/safe_float/policy/check_range_underflow.hpp>
+#include <boost/safe_float/policy/check_function_inexact.hpp>
+
 namespace boost {
 namespace safe_float{
 namespace policy{
@@ -75,12 +84,22 @@ using check_inexact_rounding = compose_check<check_addition_inexact,
 template<class FP>
 using check_bothflow = compose_check<check_overflow, check_underflow>::policy<FP>;
 
+template<class FP>
+using check_range_error = compose_check<check_range_overflow, check_range_underflow>::policy<FP>;
+
+// the errors of the <cmath> functions, their inexact results are checked by check_function_inexact
+template<class FP>
+using check_function_errors = compose_check<check_domain_error,
+                                            check_pole_error,
+                                            check_range_error>::policy<FP>;
+
 template<class FP>
 using check_all = compose_check<check_overflow,
                                 check_underflow,
                                 check_inexact_rounding,
                                 check_invalid_result,
-                                check_division_by_zero>::policy<FP>;
+                                check_division_by_zero,
+                                check_function_errors>::policy<FP>;
 }
 }
 }
@@ -0,0 +1,146 @@
+#ifndef BOOST_SAFE_FLOAT_DETAIL_BITMAP_HPP
+#define BOOST_SAFE_FLOAT_DETAIL_BITMAP_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace boost
+{
+namespace safe_float
+{
+namespace detail
+{
+inline unsigned popcount(std::uint64_t word) noexcept
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return static_cast<unsigned>(__builtin_popcountll(word));
+#else
+    unsigned bits = 0;
+    for (; word; word &= word - 1) ++bits;
+    return bits;
+#endif
+}
+
+// index of the lowest set bit of a word that is not zero
+inline unsigned lowest_bit(std::uint64_t word) noexcept
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return static_cast<unsigned>(__builtin_ctzll(word));
+#else
+    unsigned bit = 0;
+    for (; !(word & 1); word >>= 1) ++bit;
+    return bit;
+#endif
+}
+
+/**
+ * Packed bits stored with ALLOCATOR. Bit i is bit i % 64 of word i / 64, the order of Arrow validity
+ * bitmaps on little endian targets. The bits past the last one are kept cleared.
+ */
+template<class ALLOCATOR>
+class bitmap
+{
+    using word_allocator = typename std::allocator_traits<ALLOCATOR>::template rebind_alloc<std::uint64_t>;
+
+    std::vector<std::uint64_t, word_allocator> words;
+    std::size_t bits = 0;
+
+    static constexpr std::size_t word_bits = 64;
+    static constexpr std::size_t words_for(std::size_t n) noexcept { return (n + word_bits - 1) / word_bits; }
+    static constexpr std::uint64_t mask(std::size_t i) noexcept { return std::uint64_t(1) << (i % word_bits); }
+    static constexpr std::uint64_t fill(bool value) noexcept { return value ? ~std::uint64_t(0) : 0; }
+
+    // bits of the last word past the last bit
+    std::uint64_t tail() const noexcept
+    {
+        return bits % word_bits ? ~((std::uint64_t(1) << (bits % word_bits)) - 1) : 0;
+    }
+
+    void clear_tail() noexcept
+    {
+        if (!words.empty()) words.back() &= ~tail();
+    }
+
+public:
+    explicit bitmap(const ALLOCATOR& allocator = ALLOCATOR()) : words(word_allocator(allocator)) {}
+
+    bitmap(std::size_t n, bool value, const ALLOCATOR& allocator)
+        : words(words_for(n), fill(value), word_allocator(allocator)), bits(n)
+    {
+        clear_tail();
+    }
+
+    std::size_t size() const noexcept { return bits; }
+    const std::uint64_t* data() const noexcept { return words.data(); }
+
+    // the bits added take value
+    void resize(std::size_t n, bool value)
+    {
+        if (n > bits && value && !words.empty()) words.back() |= tail();
+        words.resize(words_for(n), fill(value));
+        bits = n;
+        clear_tail();
+    }
+
+    // grows geometrically, so reserving before each added bit is amortized
+    void reserve(std::size_t n)
+    {
+        if (words_for(n) > words.capacity()) words.reserve(std::max(words_for(n), 2 * words.capacity()));
+    }
+
+    bool test(std::size_t i) const noexcept { return words[i / word_bits] & mask(i); }
+    void set(std::size_t i) noexcept { words[i / word_bits] |= mask(i); }
+    void reset(std::size_t i) noexcept { words[i / word_bits] &= ~mask(i); }
+
+    void assign(bool value) noexcept
+    {
+        std::fill(words.begin(), words.end(), fill(value));
+        clear_tail();
+    }
+
+    // keeps the bits set in both bitmaps, of the same size
+    void and_with(const bitmap& other) noexcept
+    {
+        for (std::size_t w = 0; w != words.size(); ++w) words[w] &= other.words[w];
+    }
+
+    bool any() const noexcept
+    {
+        return std::any_of(words.begin(), words.end(), [](std::uint64_t word) { return word != 0; });
+    }
+
+    std::size_t count() const noexcept
+    {
+        std::size_t set_bits = 0;
+        for (std::uint64_t word : words) set_bits += popcount(word);
+        return set_bits;
+    }
+
+    // calls f with the index of each set bit, or of each cleared bit, in increasing order
+    template<class F>
+    void for_each_set(F f) const
+    {
+        for (std::size_t w = 0; w != words.size(); ++w)
+            for (std::uint64_t word = words[w]; word; word &= word - 1) f(w * word_bits + lowest_bit(word));
+    }
+
+    template<class F>
+    void for_each_cleared(F f) const
+    {
+        for (std::size_t w = 0; w != words.size(); ++w)
+        {
+            std::uint64_t word = ~words[w];
+            if (w + 1 == words.size()) word &= ~tail();
+            for (; word; word &= word - 1) f(w * word_bits + lowest_bit(word));
+        }
+    }
+};
+
+} // namespace detail
+} // namespace safe_float
+} // namespace boost
+
+#endif // BOOST_SAFE_FLOAT_DETAIL_BITMAP_HPP
@@ -0,0 +1,388 @@
+#ifndef BOOST_SAFE_FLOAT_DETAIL_CHARCONV_HPP
+#define BOOST_SAFE_FLOAT_DETAIL_CHARCONV_HPP
+
+#include <algorithm>
+#include <charconv>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <limits>
+#include <locale>
+#include <ostream>
+#include <string>
+#include <system_error>
+#include <type_traits>
+
+#include <boost/safe_float/convenience.hpp>
+#include <boost/safe_float/detail/config.hpp>
+#include <boost/safe_float/detail/ieee754.hpp>
+
+namespace boost
+{
+namespace safe_float
+{
+namespace detail
+{
+// Failures of a conversion from characters, the checks of the operations they correspond to
+enum conversion_failure : unsigned
+{
+    conversion_exact = 0,
+    conversion_overflow = 1,
+    conversion_underflow = 2,
+    conversion_inexact = 4,
+    conversion_invalid = 8
+};
+
+// Checks of the operations a policy holds, a conversion is checked as the arithmetic operations are
+template<class FP, class POLICY>
+struct conversion_checks
+{
+    template<template<class> class CHECK>
+    static constexpr bool holds = policy::is_subset<CHECK<FP>, POLICY>::value;
+
+    static constexpr bool overflow = holds<policy::check_addition_overflow> || holds<policy::check_subtraction_overflow>
+                                     || holds<policy::check_multiplication_overflow>
+                                     || holds<policy::check_division_overflow>;
+    static constexpr bool underflow = holds<policy::check_addition_underflow>
+                                      || holds<policy::check_subtraction_underflow>
+                                      || holds<policy::check_multiplication_underflow>
+                                      || holds<policy::check_division_underflow> || holds<policy::check_flush_to_zero>;
+    static constexpr bool inexact = holds<policy::check_addition_inexact> || holds<policy::check_subtraction_inexact>
+                                    || holds<policy::check_multiplication_inexact>
+                                    || holds<policy::check_division_inexact>;
+    static constexpr bool invalid = holds<policy::check_addition_invalid_result>
+                                    || holds<policy::check_subtraction_invalid_result>
+                                    || holds<policy::check_multiplication_invalid_result>
+                                    || holds<policy::check_division_invalid_result>;
+};
+
+inline int bit_length(std::uint64_t value) noexcept
+{
+    int length = 0;
+    for (; value; value >>= 1) ++length;
+    return length;
+}
+
+inline int trailing_zeros(std::uint64_t value) noexcept
+{
+    int zeros = 0;
+    for (; !(value & 1); value >>= 1) ++zeros;
+    return zeros;
+}
+
+inline bool is_digit(char c, bool hex) noexcept
+{
+    return (c >= '0' && c <= '9') || (hex && ((c >= 'a' && c <= 'f') || (c >= 'A' && c <= 'F')));
+}
+
+inline unsigned digit_value(char c) noexcept
+{
+    if (c <= '9') return static_cast<unsigned>(c - '0');
+    return static_cast<unsigned>((c | 0x20) - 'a' + 10);
+}
+
+/**
+ * Significant digits of a number written in characters, the ones std::from_chars consumed. The value of the
+ * number is mantissa * 10^exponent when its digits fit in the mantissa. The digits of hexadecimal numbers are
+ * counted in bits, their exponents are powers of 2 and their mantissa is not kept.
+ */
+struct written_number
+{
+    std::uint64_t mantissa = 0;
+    // exponent of the last significant digit
+    long long exponent = 0;
+    // exponent of the first significant digit
+    long long leading_exponent = 0;
+    // significant digits, without the leading and trailing zeros
+    long long digits = 0;
+    bool special = false;
+};
+
+// Reads the number in [first, last) consumed by std::from_chars
+inline written_number read_number(const char* first, const char* last, bool hex) noexcept
+{
+    written_number number;
+    if (first != last && *first == '-') ++first;
+    if (first != last && !is_digit(*first, hex) && *first != '.')
+    {
+        number.special = true;
+        return number;
+    }
+
+    // positions are counted from the first digit, in bits for hexadecimal numbers
+    int const digit_width = hex ? 4 : 1;
+    long long position = 0;
+    long long point = -1;
+    long long first_nonzero = -1;
+    long long last_nonzero = 0; // position after the last nonzero digit
+    for (; first != last && (is_digit(*first, hex) || *first == '.'); ++first)
+    {
+        if (*first == '.')
+        {
+            point = position;
+            continue;
+        }
+        unsigned const digit = digit_value(*first);
+        position += digit_width;
+        if (digit == 0) continue;
+        if (hex)
+        {
+            if (first_nonzero < 0) first_nonzero = position - bit_length(digit);
+            last_nonzero = position - trailing_zeros(digit);
+            continue;
+        }
+        if (first_nonzero < 0) first_nonzero = position - 1;
+        if (position - first_nonzero <= 19)
+        {
+            // the zeros since the last nonzero digit are appended with the digit
+            for (long long zero = std::max(last_nonzero, first_nonzero); zero != position - 1; ++zero)
+                number.mantissa *= 10;
+            number.mantissa = number.mantissa * 10 + digit;
+        }
+        last_nonzero = position;
+    }
+    if (point < 0) point = position;
+
+    long long written_exponent = 0;
+    if (first != last && (*first | 0x20) == (hex ? 'p' : 'e'))
+    {
+        ++first;
+        bool const negative = first != last && *first == '-';
+        if (first != last && (*first == '-' || *first == '+')) ++first;
+        // saturated, the numbers with larger exponents are out of range anyway
+        for (; first != last && is_digit(*first, false); ++first)
+            written_exponent = std::min(1000000000ll, written_exponent * 10 + (*first - '0'));
+        if (negative) written_exponent = -written_exponent;
+    }
+    if (first_nonzero < 0) return number;
+
+    number.digits = last_nonzero - first_nonzero;
+    number.exponent = written_exponent + point - last_nonzero;
+    number.leading_exponent = written_exponent + point - first_nonzero - 1;
+    return number;
+}
+
+// Largest number of significant decimal digits of a value of FP, the fractional digits of the smallest
+// subnormal and the integer digits of the largest value
+template<class FP>
+constexpr int exact_decimal_digits =
+    std::numeric_limits<FP>::digits - std::numeric_limits<FP>::min_exponent
+    + std::numeric_limits<FP>::max_exponent * 30103 / 100000 + 3;
+
+// Compares the digits written in [first, last) with the exact decimal expansion of value, the slow path for
+// numbers with too many digits to be handled as integers
+template<class FP>
+BOOST_SAFE_FLOAT_COLD bool same_decimal_expansion(const char* first, const char* last, FP value,
+                                                  const written_number& number)
+{
+    std::string expansion(exact_decimal_digits<FP> + 16, '\0');
+    auto const printed = std::to_chars(&expansion[0], &expansion[0] + expansion.size(), std::fabs(value),
+                                       std::chars_format::scientific, exact_decimal_digits<FP>);
+    if (printed.ec != std::errc()) return false;
+    const char* const exponent = std::find(expansion.data(), printed.ptr, 'e');
+    long long printed_exponent = 0;
+    std::from_chars(exponent + (exponent[1] == '+' ? 2 : 1), printed.ptr, printed_exponent);
+    if (printed_exponent != number.leading_exponent) return false;
+
+    // the significant digits are compared one by one, skipping the point of both numbers
+    const char* expanded = expansion.data();
+    const char* written = first;
+    while (written != last && (*written == '-' || *written == '0' || *written == '.')) ++written;
+    for (long long compared = 0; compared != number.digits; ++written)
+    {
+        if (*written == '.') continue;
+        if (*expanded == '.') ++expanded;
+        if (*written != *expanded++) return false;
+        ++compared;
+    }
+    for (; expanded != exponent; ++expanded)
+        if (*expanded != '0' && *expanded != '.') return false;
+    return true;
+}
+
+// Most decimal fractions have no exact binary representation, a number without exponent whose last nonzero
+// digit is a fractional one other than 5 is rejected without reading the whole number
+inline bool fraction_not_ending_in_five(const char* first, const char* last) noexcept
+{
+    const char* digit = last;
+    while (digit != first && (digit[-1] == '0' || digit[-1] == '.')) --digit;
+    if (digit == first || digit[-1] == '5' || !is_digit(digit[-1], false)) return false;
+    for (const char* c = digit; c != last; ++c)
+        if (*c == '.') return false;
+    for (const char* c = digit - 1; c != first; --c)
+    {
+        if (*c == '.') return true;
+        if (!is_digit(*c, false)) return false;
+    }
+    return false;
+}
+
+/**
+ * True when the value converted from the characters in [first, last) is the number they write. Numbers of up
+ * to 19 digits are tested with integers: m * 10^e is exact when the odd part of m * 5^e fits in the digits
+ * of FP, and its lowest bit is not below the smallest subnormal.
+ */
+template<class FP>
+bool exact_conversion(const char* first, const char* last, FP value, bool hex)
+{
+    if (!hex && fraction_not_ending_in_five(first, last)) return false;
+    written_number const number = read_number(first, last, hex);
+    if (number.special || number.digits == 0) return true;
+    int const lowest_exponent = std::numeric_limits<FP>::min_exponent - std::numeric_limits<FP>::digits;
+    if (hex)
+        return number.digits <= std::numeric_limits<FP>::digits && number.exponent >= lowest_exponent;
+    if (number.digits > 19) return same_decimal_expansion(first, last, value, number);
+
+    std::uint64_t odd = number.mantissa;
+    long long lowest_bit = number.exponent;
+    if (number.exponent >= 0)
+    {
+        for (long long i = 0; i != number.exponent; ++i)
+        {
+            if (odd > std::numeric_limits<std::uint64_t>::max() / 5)
+                return same_decimal_expansion(first, last, value, number);
+            odd *= 5;
+        }
+    }
+    else
+    {
+        // 5^-e has to divide m, then m / 10^-e = (m / 5^-e) / 2^-e
+        for (long long i = 0; i != -number.exponent; ++i)
+        {
+            if (odd % 5 != 0) return false;
+            odd /= 5;
+        }
+    }
+    int const zeros = trailing_zeros(odd);
+    odd >>= zeros;
+    lowest_bit += zeros;
+    return bit_length(odd) <= std::numeric_limits<FP>::digits && lowest_bit >= lowest_exponent;
+}
+
+// The value of a number std::from_chars rejects as out of range, rounded by the C library to infinity, to zero
+// or to a subnormal value, which some implementations reject too. The C library reads the numbers in the C
+// locale, when another one is set and the number isn't read entirely it is rounded to infinity or zero.
+template<class FP>
+BOOST_SAFE_FLOAT_COLD FP convert_out_of_range(const char* first, const char* last, bool hex)
+{
+    std::string text(first, last);
+    if (hex) text.insert(text[0] == '-' ? 1 : 0, "0x");
+    char* end;
+    FP converted;
+    if constexpr (std::is_same<FP, float>::value)
+        converted = std::strtof(text.c_str(), &end);
+    else if constexpr (std::is_same<FP, double>::value)
+        converted = std::strtod(text.c_str(), &end);
+    else
+        converted = std::strtold(text.c_str(), &end);
+    if (end == text.c_str() + text.size()) return converted;
+    written_number const number = read_number(first, last, hex);
+    converted = number.leading_exponent >= 0 ? std::numeric_limits<FP>::infinity() : FP(0);
+    return text[0] == '-' ? -converted : converted;
+}
+
+/**
+ * Converts the characters in [first, last) with std::from_chars and classifies the conversion. A number out
+ * of the range of FP is converted to the infinity or zero of its sign, the values the operations give,
+ * and std::errc::result_out_of_range is returned. The conversion is tested for exactness only when asked,
+ * it reads the characters again.
+ */
+template<class FP>
+std::from_chars_result convert_chars(const char* first, const char* last, FP& value, std::chars_format format,
+                                     bool test_exactness, unsigned& failures)
+{
+    failures = conversion_exact;
+    FP converted = 0;
+    std::from_chars_result result = std::from_chars(first, last, converted, format);
+    if (result.ec == std::errc::invalid_argument) return result;
+    bool const hex = format == std::chars_format::hex;
+
+    if (BOOST_SAFE_FLOAT_UNLIKELY(result.ec == std::errc::result_out_of_range))
+    {
+        converted = convert_out_of_range<FP>(first, result.ptr, hex);
+        // subnormal values are in range, whatever the implementation of std::from_chars tells
+        if (converted != 0 && !is_inf(converted))
+            result.ec = std::errc();
+        else
+            failures = conversion_inexact;
+    }
+
+    if (BOOST_SAFE_FLOAT_UNLIKELY(!is_normal_or_zero(converted)))
+    {
+        if (is_nan(converted))
+            failures |= conversion_invalid;
+        else if (is_inf(converted))
+            failures |= conversion_overflow;
+        else
+            failures |= conversion_underflow;
+    }
+    else if (converted == 0 && (failures || test_exactness))
+    {
+        // a nonzero number rounded to zero
+        if (failures || read_number(first, result.ptr, hex).digits != 0) failures |= conversion_underflow;
+    }
+    if (test_exactness && !(failures & (conversion_invalid | conversion_overflow | conversion_inexact))
+        && !exact_conversion(first, result.ptr, converted, hex))
+        failures |= conversion_inexact;
+    value = converted;
+    return result;
+}
+
+/**
+ * Converts the characters in [first, last) to value and reports the failures the checks of POLICY look for to a
+ * new ERROR_HANDLING, the report policies keep no state of their own. The first failure found is reported, in
+ * the order invalid result, overflow, underflow and inexact conversion. The inexact conversions are only
+ * reported when check_inexact is set.
+ */
+template<class FP, class POLICY, class ERROR_HANDLING>
+std::from_chars_result checked_from_chars(const char* first, const char* last, FP& value, std::chars_format format,
+                                          bool check_inexact = true)
+{
+    using checks = conversion_checks<FP, POLICY>;
+    unsigned failures;
+    std::from_chars_result const result
+        = convert_chars(first, last, value, format, checks::inexact && check_inexact, failures);
+    if (BOOST_SAFE_FLOAT_UNLIKELY(failures != conversion_exact))
+    {
+        ERROR_HANDLING handler;
+        if (checks::invalid && (failures & conversion_invalid))
+            handler.report_failure("Conversion from characters gave NaN");
+        else if (checks::overflow && (failures & conversion_overflow))
+            handler.report_failure("Overflow converting from characters");
+        else if (checks::underflow && (failures & conversion_underflow))
+            handler.report_failure("Underflow converting from characters");
+        else if (checks::inexact && check_inexact && (failures & conversion_inexact))
+            handler.report_failure("Inexact conversion from characters");
+    }
+    return result;
+}
+
+/**
+ * Writes value as out formats it, with std::to_chars instead of the locale facets, when the stream uses the
+ * classic locale and no flag other than fixed or scientific. False when the stream has to format the value.
+ */
+template<class FP>
+bool write_number(std::ostream& out, FP value)
+{
+    std::ios::fmtflags const flags = out.flags();
+    std::ios::fmtflags const floatfield = flags & std::ios::floatfield;
+    if (out.width() != 0 || (flags & (std::ios::showpos | std::ios::showpoint | std::ios::uppercase))
+        || floatfield == std::ios::floatfield || out.getloc() != std::locale::classic())
+        return false;
+
+    std::chars_format const format = floatfield == std::ios::fixed        ? std::chars_format::fixed
+                                     : floatfield == std::ios::scientific ? std::chars_format::scientific
+                                                                          : std::chars_format::general;
+    char buffer[64];
+    std::to_chars_result const result = std::to_chars(buffer, buffer + sizeof(buffer), value, format,
+                                                      static_cast<int>(out.precision()));
+    if (result.ec != std::errc()) return false;
+    out.write(buffer, result.ptr - buffer);
+    return true;
+}
+
+} // namespace detail
+} // namespace safe_float
+} // namespace boost
+
+#endif // BOOST_SAFE_FLOAT_DETAIL_CHARCONV_HPP
@@ -0,0 +1,192 @@
+#ifndef BOOST_SAFE_FLOAT_DETAIL_CHECK_FILTER_HPP
+#define BOOST_SAFE_FLOAT_DETAIL_CHECK_FILTER_HPP
+
+#include <functional>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include <boost/safe_float.hpp>
+
+namespace boost
+{
+namespace safe_float
+{
+namespace detail
+{
+// Kinds of the checks of the library what is known of the operands can prove useless
+enum check_kind : unsigned
+{
+    other_check = 0,
+    overflow_check = 1,
+    underflow_check = 2,
+    invalid_result_check = 4,
+    division_by_zero_check = 8,
+    subnormal_operand_check = 16
+};
+
+template<template<class> class CHECK>
+constexpr unsigned check_kind_of() noexcept
+{
+    using policy::is_same_template;
+    if (is_same_template<CHECK, policy::check_addition_overflow>::value
+        || is_same_template<CHECK, policy::check_subtraction_overflow>::value
+        || is_same_template<CHECK, policy::check_multiplication_overflow>::value
+        || is_same_template<CHECK, policy::check_division_overflow>::value)
+        return overflow_check;
+    if (is_same_template<CHECK, policy::check_addition_underflow>::value
+        || is_same_template<CHECK, policy::check_subtraction_underflow>::value
+        || is_same_template<CHECK, policy::check_multiplication_underflow>::value
+        || is_same_template<CHECK, policy::check_division_underflow>::value)
+        return underflow_check;
+    if (is_same_template<CHECK, policy::check_addition_invalid_result>::value
+        || is_same_template<CHECK, policy::check_subtraction_invalid_result>::value
+        || is_same_template<CHECK, policy::check_multiplication_invalid_result>::value
+        || is_same_template<CHECK, policy::check_division_invalid_result>::value)
+        return invalid_result_check;
+    if (is_same_template<CHECK, policy::check_division_by_zero>::value) return division_by_zero_check;
+    if (is_same_template<CHECK, policy::check_subnormal_operand>::value) return subnormal_operand_check;
+    return other_check;
+}
+
+template<template<class> class... CHECKS>
+struct kept_checks
+{
+    template<class FP>
+    using policy = policy::composed_check<FP, CHECKS...>;
+};
+
+// The checks of the list not in the kinds dropped
+template<unsigned DROPPED, class KEPT, template<class> class... CHECKS>
+struct filter_checks
+{
+    using type = KEPT;
+};
+
+template<unsigned DROPPED, template<class> class... KEPT, template<class> class FIRST, template<class> class... REST>
+struct filter_checks<DROPPED, kept_checks<KEPT...>, FIRST, REST...>
+{
+    using type = typename std::conditional_t<(DROPPED & check_kind_of<FIRST>()) != 0,
+                                             filter_checks<DROPPED, kept_checks<KEPT...>, REST...>,
+                                             filter_checks<DROPPED, kept_checks<KEPT..., FIRST>, REST...>>::type;
+};
+
+template<unsigned DROPPED, class FLAT>
+struct filter_flattened;
+
+template<unsigned DROPPED, template<class> class... CHECKS>
+struct filter_flattened<DROPPED, policy::flattened<CHECKS...>>
+{
+    using type = typename filter_checks<DROPPED, kept_checks<>, CHECKS...>::type;
+};
+
+template<class FLAT>
+struct is_flattened : std::false_type
+{};
+
+template<template<class> class... CHECKS>
+struct is_flattened<policy::flattened<CHECKS...>> : std::true_type
+{};
+
+// The checks of CHECK, composed or not, without the kinds in DROPPED
+template<class FP, template<class> class CHECK, unsigned DROPPED>
+struct dropped_checks_of
+{
+    using flat = typename policy::flattener<policy::composed_check>::template flatten_composed<CHECK<FP>>::type;
+    using leaves = std::conditional_t<is_flattened<flat>::value, flat, policy::flattened<CHECK>>;
+    using type = typename filter_flattened<DROPPED, leaves>::type::template policy<FP>;
+};
+
+template<class FP, template<class> class CHECK, unsigned DROPPED>
+using dropped_checks = typename dropped_checks_of<FP, CHECK, DROPPED>::type;
+
+template<class ERROR_HANDLING, class = void>
+struct declares_stop : std::false_type
+{};
+
+template<class ERROR_HANDLING>
+struct declares_stop<ERROR_HANDLING, std::void_t<decltype(ERROR_HANDLING::stops_on_failure)>>
+    : std::bool_constant<ERROR_HANDLING::stops_on_failure>
+{};
+
+/**
+ * True when the failures reported to ERROR_HANDLING don't return, the report policy declares it with a static
+ * constexpr bool stops_on_failure. A report_failure that may throw may as well log and return, the policies that
+ * don't declare it are assumed to continue after a failure, nothing is derived from the checks they report.
+ */
+template<class ERROR_HANDLING>
+constexpr bool stops_on_failure() noexcept
+{
+    return declares_stop<ERROR_HANDLING>::value;
+}
+
+template<class FP, class POLICY, class ERROR_HANDLING, class OP>
+constexpr bool nothrow_checked_apply() noexcept
+{
+    using traits = policy::policy_traits<FP, POLICY>;
+    if constexpr (std::is_same<OP, std::plus<FP>>::value)
+        return noexcept(traits::report_pre_addition(std::declval<POLICY&>(), FP(), FP(),
+                                                    std::declval<ERROR_HANDLING&>()))
+               && noexcept(traits::report_post_addition(std::declval<POLICY&>(), FP(),
+                                                        std::declval<ERROR_HANDLING&>()));
+    else if constexpr (std::is_same<OP, std::minus<FP>>::value)
+        return noexcept(traits::report_pre_subtraction(std::declval<POLICY&>(), FP(), FP(),
+                                                       std::declval<ERROR_HANDLING&>()))
+               && noexcept(traits::report_post_subtraction(std::declval<POLICY&>(), FP(),
+                                                           std::declval<ERROR_HANDLING&>()));
+    else if constexpr (std::is_same<OP, std::multiplies<FP>>::value)
+        return noexcept(traits::report_pre_multiplication(std::declval<POLICY&>(), FP(), FP(),
+                                                          std::declval<ERROR_HANDLING&>()))
+               && noexcept(traits::report_post_multiplication(std::declval<POLICY&>(), FP(),
+                                                              std::declval<ERROR_HANDLING&>()));
+    else
+        return noexcept(traits::report_pre_division(std::declval<POLICY&>(), FP(), FP(),
+                                                    std::declval<ERROR_HANDLING&>()))
+               && noexcept(traits::report_post_division(std::declval<POLICY&>(), FP(),
+                                                        std::declval<ERROR_HANDLING&>()));
+}
+
+/**
+ * Applies an operation with the checks of POLICY and reports their failures to a new ERROR_HANDLING, as the
+ * operators of safe_float apply it with their stored policies. Policies holding the operands between the checks
+ * live for the operation only.
+ */
+template<class FP, class POLICY, class ERROR_HANDLING, class OP>
+constexpr FP checked_apply(FP lhs, FP rhs, OP op) noexcept(nothrow_checked_apply<FP, POLICY, ERROR_HANDLING, OP>())
+{
+    using traits = policy::policy_traits<FP, POLICY>;
+    POLICY checks{};
+    ERROR_HANDLING handler{};
+    FP value{};
+    if constexpr (std::is_same<OP, std::plus<FP>>::value)
+    {
+        traits::report_pre_addition(checks, lhs, rhs, handler);
+        value = ordered_apply<FP, POLICY>(lhs, rhs, op);
+        traits::report_post_addition(checks, value, handler);
+    }
+    else if constexpr (std::is_same<OP, std::minus<FP>>::value)
+    {
+        traits::report_pre_subtraction(checks, lhs, rhs, handler);
+        value = ordered_apply<FP, POLICY>(lhs, rhs, op);
+        traits::report_post_subtraction(checks, value, handler);
+    }
+    else if constexpr (std::is_same<OP, std::multiplies<FP>>::value)
+    {
+        traits::report_pre_multiplication(checks, lhs, rhs, handler);
+        value = ordered_apply<FP, POLICY>(lhs, rhs, op);
+        traits::report_post_multiplication(checks, value, handler);
+    }
+    else
+    {
+        traits::report_pre_division(checks, lhs, rhs, handler);
+        value = ordered_apply<FP, POLICY>(lhs, rhs, op);
+        traits::report_post_division(checks, value, handler);
+    }
+    return value;
+}
+
+} // namespace detail
+} // namespace safe_float
+} // namespace boost
+
+#endif // BOOST_SAFE_FLOAT_DETAIL_CHECK_FILTER_HPP
@@ -0,0 +1,57 @@
+#ifndef BOOST_SAFE_FLOAT_DETAIL_CONFIG_HPP
+#define BOOST_SAFE_FLOAT_DETAIL_CONFIG_HPP
+
+#include <type_traits>
+
+// Branch hints and attributes keeping the failure paths out of the operators
+
+#if defined(__GNUC__) || defined(__clang__)
+#define BOOST_SAFE_FLOAT_LIKELY(condition) __builtin_expect(!!(condition), 1)
+#define BOOST_SAFE_FLOAT_UNLIKELY(condition) __builtin_expect(!!(condition), 0)
+#define BOOST_SAFE_FLOAT_COLD __attribute__((cold, noinline))
+#elif defined(_MSC_VER)
+#define BOOST_SAFE_FLOAT_LIKELY(condition) (condition)
+#define BOOST_SAFE_FLOAT_UNLIKELY(condition) (condition)
+#define BOOST_SAFE_FLOAT_COLD __declspec(noinline)
+#else
+#define BOOST_SAFE_FLOAT_LIKELY(condition) (condition)
+#define BOOST_SAFE_FLOAT_UNLIKELY(condition) (condition)
+#define BOOST_SAFE_FLOAT_COLD
+#endif
+
+// Facts the optimizer may rely on, the condition has to hold
+#if defined(__has_cpp_attribute)
+#if __has_cpp_attribute(assume)
+#define BOOST_SAFE_FLOAT_ASSUME(condition) [[assume(condition)]]
+#endif
+#endif
+#if !defined(BOOST_SAFE_FLOAT_ASSUME)
+#if defined(__clang__)
+#define BOOST_SAFE_FLOAT_ASSUME(condition) __builtin_assume(condition)
+#elif defined(__GNUC__)
+#define BOOST_SAFE_FLOAT_ASSUME(condition)         \
+    do                                             \
+    {                                              \
+        if (!(condition)) __builtin_unreachable(); \
+    } while (false)
+#elif defined(_MSC_VER)
+#define BOOST_SAFE_FLOAT_ASSUME(condition) __assume(condition)
+#else
+#define BOOST_SAFE_FLOAT_ASSUME(condition) static_cast<void>(0)
+#endif
+#endif
+
+// Detection of constant evaluation, selecting the value checks when the flags can't be read. Without it the
+// operations are only usable in constant expressions when every type checks the values
+#if defined(__cpp_lib_is_constant_evaluated)
+#define BOOST_SAFE_FLOAT_HAS_IS_CONSTANT_EVALUATED
+#define BOOST_SAFE_FLOAT_IS_CONSTANT_EVALUATED() std::is_constant_evaluated()
+#elif (defined(__GNUC__) && __GNUC__ >= 9) || (defined(__clang__) && __clang_major__ >= 9) \
+    || (defined(_MSC_VER) && _MSC_VER >= 1925)
+#define BOOST_SAFE_FLOAT_HAS_IS_CONSTANT_EVALUATED
+#define BOOST_SAFE_FLOAT_IS_CONSTANT_EVALUATED() __builtin_is_constant_evaluated()
+#else
+#define BOOST_SAFE_FLOAT_IS_CONSTANT_EVALUATED() false
+#endif
+
+#endif // BOOST_SAFE_FLOAT_DETAIL_CONFIG_HPP
@@ -0,0 +1,396 @@
+#ifndef BOOST_SAFE_FLOAT_DETAIL_FENV_BACKEND_HPP
+#define BOOST_SAFE_FLOAT_DETAIL_FENV_BACKEND_HPP
+
+#include <atomic>
+#include <cfenv>
+#include <limits>
+#include <type_traits>
+
+#include <boost/safe_float/detail/config.hpp>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <xmmintrin.h>
+#endif
+
+// Selection of the way the CHECK policies detect failures, for each floating point type:
+//   0 : checking the values before and after each operation
+//   1 : testing the floating point flags with libc
+//   2 : testing the floating point flags with the native backend of the type
+// The selection is taken from the configuration generated by the build scripts when it is available,
+// defining FENV_AVAILABLE forces the native backend for every type.
+#if defined(FENV_AVAILABLE)
+#if defined(BOOST_SAFE_FLOAT_FENV_USE_LIBC)
+#define BOOST_SAFE_FLOAT_FENV_FORCED_MODE 1
+#else
+#define BOOST_SAFE_FLOAT_FENV_FORCED_MODE 2
+#endif
+#ifndef BOOST_SAFE_FLOAT_FENV_MODE_FLOAT
+#define BOOST_SAFE_FLOAT_FENV_MODE_FLOAT BOOST_SAFE_FLOAT_FENV_FORCED_MODE
+#endif
+#ifndef BOOST_SAFE_FLOAT_FENV_MODE_DOUBLE
+#define BOOST_SAFE_FLOAT_FENV_MODE_DOUBLE BOOST_SAFE_FLOAT_FENV_FORCED_MODE
+#endif
+#ifndef BOOST_SAFE_FLOAT_FENV_MODE_LONG_DOUBLE
+#define BOOST_SAFE_FLOAT_FENV_MODE_LONG_DOUBLE BOOST_SAFE_FLOAT_FENV_FORCED_MODE
+#endif
+#elif !defined(BOOST_SAFE_FLOAT_NO_FENV_CONFIG) && defined(__has_include)
+#if __has_include(<boost/safe_float/fenv_config.hpp>)
+#include <boost/safe_float/fenv_config.hpp>
+#endif
+#endif
+
+#ifndef BOOST_SAFE_FLOAT_FENV_MODE_FLOAT
+#define BOOST_SAFE_FLOAT_FENV_MODE_FLOAT 0
+#endif
+#ifndef BOOST_SAFE_FLOAT_FENV_MODE_DOUBLE
+#define BOOST_SAFE_FLOAT_FENV_MODE_DOUBLE 0
+#endif
+#ifndef BOOST_SAFE_FLOAT_FENV_MODE_LONG_DOUBLE
+#define BOOST_SAFE_FLOAT_FENV_MODE_LONG_DOUBLE 0
+#endif
+
+// The pragma is required by the policies as soon as one type tests the flags
+#if BOOST_SAFE_FLOAT_FENV_MODE_FLOAT || BOOST_SAFE_FLOAT_FENV_MODE_DOUBLE || BOOST_SAFE_FLOAT_FENV_MODE_LONG_DOUBLE
+#define BOOST_SAFE_FLOAT_FENV_ACCESS
+#endif
+
+// Architecture detection for the native backends.
+// float and double are handled by the SSE unit only when the compiler is
+// generating SSE code for them, long double is handled by the x87 unit when it
+// is the 80 bits extended type.
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define BOOST_SAFE_FLOAT_HAS_X87_ASM
+#if defined(__SSE_MATH__)
+#define BOOST_SAFE_FLOAT_HAS_SSE_FLOAT
+#endif
+#if defined(__SSE2_MATH__)
+#define BOOST_SAFE_FLOAT_HAS_SSE_DOUBLE
+#endif
+#elif defined(_MSC_VER) && (defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#define BOOST_SAFE_FLOAT_HAS_SSE_FLOAT
+#define BOOST_SAFE_FLOAT_HAS_SSE_DOUBLE
+#endif
+
+namespace boost
+{
+namespace safe_float
+{
+namespace detail
+{
+/**
+ * Floating point environment backends.
+ *
+ * Each backend provides the subset of <cfenv> used by the CHECK policies, clearexcept and testexcept,
+ * with the same semantics of std::feclearexcept and std::fetestexcept. The native backends only touch
+ * the unit that computes a given floating point type, avoiding the out-of-line libc calls that need to
+ * read and write both the x87 and SSE states.
+ */
+enum class fenv_backend_kind { libc, sse, x87 };
+
+enum class fenv_mode { value_checks = 0, libc = 1, native = 2 };
+
+// Portable implementation relying on libc.
+struct libc_fenv_backend
+{
+    static constexpr fenv_backend_kind kind = fenv_backend_kind::libc;
+
+    static int clearexcept(int excepts) { return std::feclearexcept(excepts); }
+    static int testexcept(int excepts) { return std::fetestexcept(excepts); }
+};
+
+#if defined(BOOST_SAFE_FLOAT_HAS_SSE_FLOAT) || defined(BOOST_SAFE_FLOAT_HAS_SSE_DOUBLE) \
+    || defined(BOOST_SAFE_FLOAT_HAS_X87_ASM)
+// Exception flags share the same layout, bits 0 to 5, in the MXCSR register and the x87 status word
+struct x86_fenv_flags
+{
+    static constexpr unsigned invalid = 0x01;
+    static constexpr unsigned denormal = 0x02;
+    static constexpr unsigned divbyzero = 0x04;
+    static constexpr unsigned overflow = 0x08;
+    static constexpr unsigned underflow = 0x10;
+    static constexpr unsigned inexact = 0x20;
+
+    static constexpr unsigned to_flags(int excepts)
+    {
+        return ((excepts & FE_INVALID) ? invalid : 0u) | ((excepts & FE_DIVBYZERO) ? divbyzero : 0u)
+               | ((excepts & FE_OVERFLOW) ? overflow : 0u) | ((excepts & FE_UNDERFLOW) ? underflow : 0u)
+               | ((excepts & FE_INEXACT) ? inexact : 0u);
+    }
+
+    static constexpr int from_flags(unsigned flags)
+    {
+        return ((flags & invalid) ? FE_INVALID : 0) | ((flags & divbyzero) ? FE_DIVBYZERO : 0)
+               | ((flags & overflow) ? FE_OVERFLOW : 0) | ((flags & underflow) ? FE_UNDERFLOW : 0)
+               | ((flags & inexact) ? FE_INEXACT : 0);
+    }
+};
+#endif
+
+#if defined(BOOST_SAFE_FLOAT_HAS_SSE_FLOAT) || defined(BOOST_SAFE_FLOAT_HAS_SSE_DOUBLE)
+// Implementation reading and writing the MXCSR register.
+struct sse_fenv_backend : x86_fenv_flags
+{
+    static constexpr fenv_backend_kind kind = fenv_backend_kind::sse;
+
+    // control bits of the MXCSR register
+    static constexpr unsigned denormals_are_zero = 0x0040;
+    static constexpr unsigned flush_to_zero = 0x8000;
+    static constexpr unsigned rounding_control = 0x6000;
+    static constexpr unsigned rounding_shift = 13;
+
+    static unsigned get_csr()
+    {
+#if defined(__GNUC__)
+        unsigned csr;
+        __asm__ __volatile__("stmxcsr %0" : "=m"(csr) : : "memory");
+        return csr;
+#else
+        return _mm_getcsr();
+#endif
+    }
+
+    static void set_csr(unsigned csr)
+    {
+#if defined(__GNUC__)
+        __asm__ __volatile__("ldmxcsr %0" : : "m"(csr) : "memory");
+#else
+        _mm_setcsr(csr);
+#endif
+    }
+
+    static int clearexcept(int excepts)
+    {
+        unsigned const csr = get_csr();
+        unsigned const flags = to_flags(excepts);
+        // Writing MXCSR is much more expensive than reading it, skip it when nothing is raised
+        if (csr & flags) set_csr(csr & ~flags);
+        return 0;
+    }
+
+    static int testexcept(int excepts) { return from_flags(get_csr() & to_flags(excepts)); }
+};
+#endif
+
+#if defined(BOOST_SAFE_FLOAT_HAS_X87_ASM)
+// Implementation reading the x87 status word with fnstsw.
+struct x87_fenv_backend : x86_fenv_flags
+{
+    static constexpr fenv_backend_kind kind = fenv_backend_kind::x87;
+
+    static unsigned short get_status()
+    {
+        unsigned short sw;
+        __asm__ __volatile__("fnstsw %0" : "=am"(sw) : : "memory");
+        return sw;
+    }
+
+    static int clearexcept(int excepts)
+    {
+        unsigned short const flags = static_cast<unsigned short>(to_flags(excepts));
+        if ((get_status() & flags) == 0) return 0;
+        // The status word can only be written through the whole environment
+        struct
+        {
+            unsigned short control_word, unused1, status_word, unused2;
+            unsigned int others[5];
+        } env;
+        __asm__ __volatile__("fnstenv %0" : "=m"(env) : : "memory");
+        env.status_word &= static_cast<unsigned short>(~flags);
+        __asm__ __volatile__("fldenv %0" : : "m"(env) : "memory");
+        return 0;
+    }
+
+    static int testexcept(int excepts) { return from_flags(get_status() & to_flags(excepts)); }
+
+    // control bits of the x87 control word
+    static constexpr unsigned short rounding_control = 0x0C00;
+    static constexpr unsigned rounding_shift = 10;
+
+    static unsigned short get_control()
+    {
+        unsigned short cw;
+        __asm__ __volatile__("fnstcw %0" : "=m"(cw) : : "memory");
+        return cw;
+    }
+
+    static void set_control(unsigned short cw) { __asm__ __volatile__("fldcw %0" : : "m"(cw) : "memory"); }
+};
+#endif
+
+// Native backend available for each floating point type
+template<class FP>
+struct native_fenv_backend
+{
+    using type = libc_fenv_backend;
+};
+
+#if defined(BOOST_SAFE_FLOAT_HAS_SSE_FLOAT)
+template<>
+struct native_fenv_backend<float>
+{
+    using type = sse_fenv_backend;
+};
+#endif
+
+#if defined(BOOST_SAFE_FLOAT_HAS_SSE_DOUBLE)
+template<>
+struct native_fenv_backend<double>
+{
+    using type = sse_fenv_backend;
+};
+#endif
+
+#if defined(BOOST_SAFE_FLOAT_HAS_X87_ASM)
+template<>
+struct native_fenv_backend<long double>
+{
+    // long double may be an alias of double (i.e. -mlong-double-64), then it is computed as double
+    using type = std::conditional_t<std::numeric_limits<long double>::digits == std::numeric_limits<double>::digits,
+                                    typename native_fenv_backend<double>::type, x87_fenv_backend>;
+};
+#endif
+
+// Mode used by the CHECK policies for each floating point type
+template<class FP>
+struct fenv_mode_selector
+{
+    static constexpr fenv_mode value = fenv_mode::value_checks;
+};
+
+template<>
+struct fenv_mode_selector<float>
+{
+    static constexpr fenv_mode value = static_cast<fenv_mode>(BOOST_SAFE_FLOAT_FENV_MODE_FLOAT);
+};
+
+template<>
+struct fenv_mode_selector<double>
+{
+    static constexpr fenv_mode value = static_cast<fenv_mode>(BOOST_SAFE_FLOAT_FENV_MODE_DOUBLE);
+};
+
+template<>
+struct fenv_mode_selector<long double>
+{
+    static constexpr fenv_mode value = static_cast<fenv_mode>(BOOST_SAFE_FLOAT_FENV_MODE_LONG_DOUBLE);
+};
+
+template<class FP>
+constexpr fenv_mode fenv_mode_of = fenv_mode_selector<FP>::value;
+
+// true when the CHECK policies test the floating point flags for FP in place of the values
+template<class FP>
+constexpr bool uses_fenv = fenv_mode_of<FP> != fenv_mode::value_checks;
+
+// true when the flags are tested for FP in the current evaluation, constant evaluation checks the values
+template<class FP>
+constexpr bool tests_fenv() noexcept
+{
+    if constexpr (uses_fenv<FP>)
+        return !BOOST_SAFE_FLOAT_IS_CONSTANT_EVALUATED();
+    else
+        return false;
+}
+
+template<class FP>
+using fenv_backend = std::conditional_t<fenv_mode_of<FP> == fenv_mode::libc, libc_fenv_backend,
+                                        typename native_fenv_backend<FP>::type>;
+
+// A CHECK policy reading the flags whatever the mode is declares a static constexpr bool reads_fenv_flags
+template<class POLICY, class = void>
+struct policy_reads_fenv_flags : std::false_type
+{
+};
+
+template<class POLICY>
+struct policy_reads_fenv_flags<POLICY, std::void_t<decltype(POLICY::reads_fenv_flags)>>
+    : std::bool_constant<POLICY::reads_fenv_flags>
+{
+};
+
+// true when the operations checked by POLICY for FP need to be kept between the flags manipulation
+template<class FP, class POLICY>
+constexpr bool orders_fenv = uses_fenv<FP> || policy_reads_fenv_flags<POLICY>::value;
+
+// A CHECK policy whose state is only kept by its value checks declares a static constexpr bool value_checks_state
+template<class POLICY, class = void>
+struct policy_value_checks_state : std::false_type
+{
+};
+
+template<class POLICY>
+struct policy_value_checks_state<POLICY, std::void_t<decltype(POLICY::value_checks_state)>>
+    : std::bool_constant<POLICY::value_checks_state>
+{
+};
+
+// true when the checks of a block of operations on FP can share one POLICY: the flags are tested for FP and the
+// policy keeps no state for them, the pre checks of the block clear the flags and the post checks test the flags
+// raised by the whole block
+template<class FP, class POLICY>
+constexpr bool batches_fenv
+    = uses_fenv<FP> && (std::is_empty_v<POLICY> || policy_value_checks_state<POLICY>::value);
+
+/**
+ * Compiler barrier used around checked operations when flags are tested. It forces the value to be
+ * materialized in a register of the unit computing it, so the operation can't be moved before the flags
+ * are cleared or after they are tested.
+ */
+template<class FP>
+inline void fenv_barrier(FP& value)
+{
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+    if constexpr (fenv_backend<FP>::kind == fenv_backend_kind::sse)
+        __asm__ __volatile__("" : "+x"(value));
+    else if constexpr (fenv_backend<FP>::kind == fenv_backend_kind::x87)
+        __asm__ __volatile__("" : "+t"(value));
+    else
+        __asm__ __volatile__("" : "+m"(value) : : "memory");
+#elif defined(__GNUC__)
+    __asm__ __volatile__("" : "+m"(value) : : "memory");
+#else
+    FP volatile materialized = value;
+    value = materialized;
+#endif
+}
+
+// Applies a binary operation keeping it between the surrounding flags manipulation.
+template<class FP, class OP>
+inline FP fenv_ordered(FP lhs, FP rhs, OP op)
+{
+    fenv_barrier(lhs);
+    fenv_barrier(rhs);
+    FP result = op(lhs, rhs);
+    fenv_barrier(result);
+    return result;
+}
+
+// Applies a binary operation checked by POLICY, keeping it between the flags manipulation when needed
+template<class FP, class POLICY, class OP>
+constexpr FP ordered_apply(FP lhs, FP rhs, OP op)
+{
+    if constexpr (orders_fenv<FP, POLICY>)
+    {
+        if (!BOOST_SAFE_FLOAT_IS_CONSTANT_EVALUATED()) return fenv_ordered(lhs, rhs, op);
+    }
+    return op(lhs, rhs);
+}
+
+/**
+ * Compiler barrier for loops of operations whose flags are tested together: the loads and stores of the
+ * loop can't be moved across it.
+ */
+inline void fenv_memory_barrier() noexcept
+{
+#if defined(__GNUC__)
+    __asm__ __volatile__("" : : : "memory");
+#else
+    std::atomic_signal_fence(std::memory_order_seq_cst);
+#endif
+}
+
+} // namespace detail
+} // namespace safe_float
+} // namespace boost
+
+#endif // BOOST_SAFE_FLOAT_DETAIL_FENV_BACKEND_HPP
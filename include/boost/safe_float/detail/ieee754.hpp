@@ -0,0 +1,149 @@
+#ifndef BOOST_SAFE_FLOAT_DETAIL_IEEE754_HPP
+#define BOOST_SAFE_FLOAT_DETAIL_IEEE754_HPP
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+
+#include <boost/safe_float/detail/config.hpp>
+
+// The x87 extended format is only read on little endian x86
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#define BOOST_SAFE_FLOAT_HAS_X87_EXTENDED_FORMAT
+#endif
+
+namespace boost
+{
+namespace safe_float
+{
+namespace detail
+{
+/**
+ * Tests on the representation of the IEEE 754 formats.
+ *
+ * They only read the exponent field, which is cheaper than classifying the value and is not affected by
+ * the denormals are zero mode, where comparisons read subnormal values as zero.
+ */
+template<class FP>
+struct ieee754_format
+{
+    static constexpr int digits = std::numeric_limits<FP>::digits;
+    static constexpr bool binary32 = std::numeric_limits<FP>::is_iec559 && digits == 24;
+    static constexpr bool binary64 = std::numeric_limits<FP>::is_iec559 && digits == 53;
+#if defined(BOOST_SAFE_FLOAT_HAS_X87_EXTENDED_FORMAT)
+    static constexpr bool x87_extended = std::numeric_limits<FP>::is_iec559 && digits == 64;
+#else
+    static constexpr bool x87_extended = false;
+#endif
+    static constexpr bool known = binary32 || binary64 || x87_extended;
+};
+
+// Biased exponent field of value, 0 for zero and subnormal values
+template<class FP>
+inline unsigned exponent_field(const FP& value)
+{
+    static_assert(ieee754_format<FP>::known, "unknown floating point format");
+    if constexpr (ieee754_format<FP>::binary32)
+    {
+        std::uint32_t bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+        return (bits >> 23) & 0xFF;
+    }
+    else if constexpr (ieee754_format<FP>::binary64)
+    {
+        std::uint64_t bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+        return (bits >> 52) & 0x7FF;
+    }
+    else
+    {
+        // the 64 bits significand is followed by the sign and exponent fields
+        std::uint16_t bits;
+        std::memcpy(&bits, reinterpret_cast<const unsigned char*>(&value) + 8, sizeof(bits));
+        return bits & 0x7FFF;
+    }
+}
+
+// Significand field of value, without the sign and exponent fields
+template<class FP>
+inline std::uint64_t significand_field(const FP& value)
+{
+    static_assert(ieee754_format<FP>::known, "unknown floating point format");
+    if constexpr (ieee754_format<FP>::binary32)
+    {
+        std::uint32_t bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+        return bits & 0x7FFFFF;
+    }
+    else
+    {
+        std::uint64_t bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+        return ieee754_format<FP>::binary64 ? bits & 0xFFFFFFFFFFFFFull : bits;
+    }
+}
+
+/**
+ * Classification used by the value checks. The cmath functions are not constexpr, constant evaluation
+ * compares the values instead.
+ */
+template<class FP>
+constexpr bool is_nan(const FP& value) noexcept
+{
+    if (BOOST_SAFE_FLOAT_IS_CONSTANT_EVALUATED()) return value != value;
+    return std::isnan(value);
+}
+
+template<class FP>
+constexpr bool is_inf(const FP& value) noexcept
+{
+    if (BOOST_SAFE_FLOAT_IS_CONSTANT_EVALUATED())
+        return value == std::numeric_limits<FP>::infinity() || value == -std::numeric_limits<FP>::infinity();
+    return std::isinf(value);
+}
+
+template<class FP>
+constexpr bool is_subnormal(const FP& value) noexcept
+{
+    if (BOOST_SAFE_FLOAT_IS_CONSTANT_EVALUATED())
+        return value != 0 && value < std::numeric_limits<FP>::min() && value > -std::numeric_limits<FP>::min();
+    return std::fpclassify(value) == FP_SUBNORMAL;
+}
+
+// true for normal values and zeros, compared without branches so loops over values are vectorized
+template<class FP>
+constexpr bool is_normal_or_zero(const FP& value) noexcept
+{
+    FP const magnitude = value < 0 ? -value : value;
+    return ((magnitude >= std::numeric_limits<FP>::min()) & (magnitude <= std::numeric_limits<FP>::max()))
+           | (value == 0);
+}
+
+// true for finite values without a fractional part, the values of magnitude 2^(digits-1) or more have none
+template<class FP>
+constexpr bool is_integral_value(const FP& value) noexcept
+{
+    constexpr FP no_fraction = FP(1ull << (std::numeric_limits<FP>::digits - 1));
+    FP const magnitude = value < 0 ? -value : value;
+    if (!(magnitude < no_fraction)) return !is_nan(value) && !is_inf(value);
+    return magnitude == FP(static_cast<unsigned long long>(magnitude));
+}
+
+// true for subnormal values, tested on the representation when the format is known
+template<class FP>
+constexpr bool is_subnormal_representation(const FP& value) noexcept
+{
+    if (BOOST_SAFE_FLOAT_IS_CONSTANT_EVALUATED())
+        return is_subnormal(value);
+    else if constexpr (ieee754_format<FP>::known)
+        return exponent_field(value) == 0 && significand_field(value) != 0;
+    else
+        return std::fpclassify(value) == FP_SUBNORMAL;
+}
+
+} // namespace detail
+} // namespace safe_float
+} // namespace boost
+
+#endif // BOOST_SAFE_FLOAT_DETAIL_IEEE754_HPP
@@ -0,0 +1,78 @@
+#ifndef BOOST_SAFE_FLOAT_FLUSH_TO_ZERO_HPP
+#define BOOST_SAFE_FLOAT_FLUSH_TO_ZERO_HPP
+
+#include <boost/safe_float/detail/fenv_backend.hpp>
+
+namespace boost
+{
+namespace safe_float
+{
+namespace detail
+{
+// True when check_flush_to_zero cleared an underflow flag raised before the operations it checks. It is kept by
+// the thread, flush_to_zero_scope reads it with the flag
+inline bool& underflow_cleared() noexcept
+{
+    static thread_local bool cleared = false;
+    return cleared;
+}
+} // namespace detail
+
+/**
+ * Scope running the computations of the SSE unit in flush to zero (FTZ) and denormals are zero (DAZ) modes.
+ *
+ * Subnormal results are replaced by zero and subnormal operands are read as zero, avoiding the microcode
+ * assists that make operations on subnormals much slower. The unit still raises the underflow flag when it
+ * flushes a result, the flag is cleared when the scope starts so flushed() tells if a result was flushed
+ * inside the scope. check_flush_to_zero clears the flag before the operations it checks, flushed() also reads
+ * the flags it cleared. The previous modes are restored at the end of the scope, the underflow flag raised
+ * before the scope is kept and the one raised inside it is raised again.
+ *
+ * Only float and double computed by the SSE unit are affected, the scope does nothing on other platforms
+ * and for long double computed by the x87 unit.
+ */
+class flush_to_zero_scope
+{
+#if defined(BOOST_SAFE_FLOAT_HAS_SSE_FLOAT) || defined(BOOST_SAFE_FLOAT_HAS_SSE_DOUBLE)
+    using backend = detail::sse_fenv_backend;
+    static constexpr unsigned modes = backend::flush_to_zero | backend::denormals_are_zero;
+    unsigned saved;
+    bool saved_cleared;
+
+public:
+    flush_to_zero_scope() : saved(backend::get_csr()), saved_cleared(detail::underflow_cleared())
+    {
+        detail::underflow_cleared() = false;
+        backend::set_csr((saved | modes) & ~backend::underflow);
+    }
+
+    ~flush_to_zero_scope()
+    {
+        unsigned const csr = backend::get_csr();
+        unsigned const raised = detail::underflow_cleared() ? backend::underflow : 0u;
+        detail::underflow_cleared() = saved_cleared;
+        backend::set_csr((csr & ~modes) | raised | (saved & (modes | backend::underflow)));
+    }
+
+    // true if a result was flushed to zero since the scope started
+    bool flushed() const { return (backend::get_csr() & backend::underflow) || detail::underflow_cleared(); }
+
+    // true if the modes are set, inside a scope or by other means
+    static bool active() { return (backend::get_csr() & modes) == modes; }
+#else
+public:
+    flush_to_zero_scope() {}
+
+    bool flushed() const { return false; }
+
+    static bool active() { return false; }
+#endif
+
+    flush_to_zero_scope(const flush_to_zero_scope&) = delete;
+    flush_to_zero_scope& operator=(const flush_to_zero_scope&) = delete;
+};
+
+} // namespace safe_float
+} // namespace boost
+
+#endif // BOOST_SAFE_FLOAT_FLUSH_TO_ZERO_HPP
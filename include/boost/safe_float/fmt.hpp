@@ -0,0 +1,23 @@
+#ifndef BOOST_SAFE_FLOAT_FMT_HPP
+#define BOOST_SAFE_FLOAT_FMT_HPP
+
+#include <fmt/format.h>
+
+#include <boost/safe_float.hpp>
+
+namespace fmt
+{
+// Formats the stored value with the format specifications of FP, the shortest round trip by default
+template<class FP, template<class T> class CHECK, class ERROR_HANDLING, template<class T> class CAST>
+struct formatter<boost::safe_float::safe_float<FP, CHECK, ERROR_HANDLING, CAST>, char> : formatter<FP, char>
+{
+    template<class FORMAT_CONTEXT>
+    auto format(const boost::safe_float::safe_float<FP, CHECK, ERROR_HANDLING, CAST>& value,
+                FORMAT_CONTEXT& context) const
+    {
+        return formatter<FP, char>::format(value.get_stored_value(), context);
+    }
+};
+} // namespace fmt
+
+#endif // BOOST_SAFE_FLOAT_FMT_HPP
@@ -673,7 +673,7 @@ constexpr auto parse_float_literal()
 
 
 template<char... STR>
-boost::safe_float::safe_float<float> operator""_sf()
+constexpr boost::safe_float::safe_float<float> operator""_sf()
 {
     using number = decltype(detail::parse_float_literal<STR...>());
     if constexpr(detail::is_number<number>::value) {
@@ -692,7 +692,7 @@ boost::safe_float::safe_float<float> operator""_sf()
 }
 
 template<char... STR>
-boost::safe_float::safe_float<double> operator""_sd()
+constexpr boost::safe_float::safe_float<double> operator""_sd()
 {
     using number = decltype(detail::parse_float_literal<STR...>());
     if constexpr(detail::is_number<number>::value) {
@@ -712,7 +712,7 @@ boost::safe_float::safe_float<double> operator""_sd()
 }
 
 template<char... STR>
-boost::safe_float::safe_float<long double> operator""_sld()
+constexpr boost::safe_float::safe_float<long double> operator""_sld()
 {
     using number = decltype(detail::parse_float_literal<STR...>());
     if constexpr(detail::is_number<number>::value) {
@@ -0,0 +1,107 @@
+#ifndef BOOST_SAFE_FLOAT_PARALLEL_HPP
+#define BOOST_SAFE_FLOAT_PARALLEL_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <cfenv>
+#include <cstddef>
+#include <exception>
+#include <thread>
+#include <vector>
+
+#include <boost/safe_float/policy/on_fail_count.hpp>
+
+namespace boost
+{
+namespace safe_float
+{
+/**
+ * Group of tasks running on their own threads, propagating the floating point state to the joining thread.
+ *
+ * The floating point flags and the failures counted by policy::on_fail_count belong to the thread raising
+ * them. Each task runs with the floating point environment of the thread that started it, with the flags
+ * cleared, and at the end of the task its flags and counted failures are merged into the group without
+ * locks. wait() joins the tasks and raises the merged flags and failures in the calling thread, as if the
+ * tasks had run there. The first exception thrown by a task, i.e. by on_fail_throw, is rethrown by wait().
+ */
+class task_group
+{
+    std::vector<std::thread> workers;
+    std::atomic<int> raised_flags{0};
+    std::atomic<unsigned long long> counted_failures{0};
+    std::atomic<bool> failed{false};
+    std::exception_ptr failure;
+
+public:
+    task_group() = default;
+    task_group(const task_group&) = delete;
+    task_group& operator=(const task_group&) = delete;
+
+    ~task_group()
+    {
+        for (auto& worker : workers)
+            if (worker.joinable()) worker.join();
+    }
+
+    template<class TASK>
+    void run(TASK task)
+    {
+        std::fenv_t environment;
+        std::fegetenv(&environment);
+        workers.emplace_back([this, task, environment]() {
+            std::fesetenv(&environment);
+            std::feclearexcept(FE_ALL_EXCEPT);
+            unsigned long long const counted = policy::on_fail_count::count();
+            try
+            {
+                task();
+            }
+            catch (...)
+            {
+                if (!failed.exchange(true)) failure = std::current_exception();
+            }
+            raised_flags.fetch_or(std::fetestexcept(FE_ALL_EXCEPT), std::memory_order_relaxed);
+            counted_failures.fetch_add(policy::on_fail_count::count() - counted, std::memory_order_relaxed);
+        });
+    }
+
+    void wait()
+    {
+        for (auto& worker : workers) worker.join();
+        workers.clear();
+        if (int const flags = raised_flags.exchange(0, std::memory_order_relaxed)) std::feraiseexcept(flags);
+        policy::on_fail_count::add(counted_failures.exchange(0, std::memory_order_relaxed));
+        if (failed.exchange(false))
+        {
+            std::exception_ptr rethrown;
+            std::swap(rethrown, failure);
+            std::rethrow_exception(rethrown);
+        }
+    }
+};
+
+/**
+ * Calls body(i) for each i in [first, last), splitting the range in contiguous chunks run by a task_group.
+ */
+template<class INDEX, class BODY>
+void parallel_for(INDEX first, INDEX last, BODY body, unsigned threads = std::thread::hardware_concurrency())
+{
+    if (last <= first) return;
+    std::size_t const size = static_cast<std::size_t>(last - first);
+    std::size_t const chunks = std::min<std::size_t>(std::max(threads, 1u), size);
+    task_group group;
+    for (std::size_t chunk = 0; chunk < chunks; ++chunk)
+    {
+        INDEX const begin = first + static_cast<INDEX>(size * chunk / chunks);
+        INDEX const end = first + static_cast<INDEX>(size * (chunk + 1) / chunks);
+        group.run([begin, end, &body] {
+            for (INDEX i = begin; i != end; ++i) body(i);
+        });
+    }
+    group.wait();
+}
+
+} // namespace safe_float
+} // namespace boost
+
+#endif // BOOST_SAFE_FLOAT_PARALLEL_HPP
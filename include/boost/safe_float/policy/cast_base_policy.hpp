@@ -23,7 +23,8 @@ struct cast_policy
     static constexpr bool can_explicitly_cast_from = false;
 
     template<typename T>
-    static void cast_from(FP& target, T source)
+    static constexpr void cast_from(FP& target, T source)
+        noexcept(std::is_nothrow_assignable_v<FP&, T>)
     {
         target = source;
     }
@@ -35,7 +36,8 @@ struct cast_policy
     static constexpr bool can_explicitly_cast_to = false;
 
     template<typename T>
-    static T cast_to(FP source)
+    static constexpr T cast_to(FP source)
+        noexcept(std::is_nothrow_constructible_v<T, FP>)
     {
         return T(source);
     }
@@ -62,23 +64,25 @@ template<typename FP, typename CAST_POLICY>
 struct cast_helper
 {
     template<typename T, std::enable_if_t<CAST_POLICY::template can_cast_from<T>, int> = 0>
-    static void construct_implicitly(FP& target, T source)
+    static constexpr void construct_implicitly(FP& target, T source)
+        noexcept(noexcept(CAST_POLICY::template cast_from<T>(target, source)))
     {
         CAST_POLICY::template cast_from<T>(target, source);
     }
     template<typename T, std::enable_if_t<CAST_POLICY::template can_explicitly_cast_from<T>, int> = 0>
-    static void construct_explicitly(FP& target, T source)
+    static constexpr void construct_explicitly(FP& target, T source)
+        noexcept(noexcept(CAST_POLICY::template cast_from<T>(target, source)))
     {
         CAST_POLICY::template cast_from<T>(target, source);
     }
 
     template<typename T, std::enable_if_t<CAST_POLICY::template can_cast_to<T>, int> = 0>
-    static T convert_implicitly(FP source)
+    static constexpr T convert_implicitly(FP source) noexcept(noexcept(CAST_POLICY::template cast_to<T>(source)))
     {
         return CAST_POLICY::template cast_to<T>(source);
     }
     template<typename T, std::enable_if_t<CAST_POLICY::template can_explicitly_cast_to<T>, int> = 0>
-    static T convert_explicitly(FP source)
+    static constexpr T convert_explicitly(FP source) noexcept(noexcept(CAST_POLICY::template cast_to<T>(source)))
     {
         return CAST_POLICY::template cast_to<T>(source);
     }
@@ -21,7 +21,8 @@ struct allow_cast_from {
         static constexpr bool can_explicitly_cast_from = false;
 
         template<typename U, std::enable_if_t<std::is_same_v<T, U>, int> = 0>
-        static void cast_from(typename SF::value_type& target, T source)
+        static constexpr void cast_from(typename SF::value_type& target, T source)
+            noexcept(std::is_nothrow_assignable_v<typename SF::value_type&, T>)
         {
             target = source;
         }
@@ -48,7 +49,8 @@ struct allow_explicit_cast_from {
         static constexpr bool can_explicitly_cast_from = std::is_same_v<T, U>;
 
         template<typename U, std::enable_if_t<std::is_same_v<T, U>, int> = 0>
-        static void cast_from(typename SF::value_type& target, T source)
+        static constexpr void cast_from(typename SF::value_type& target, T source)
+            noexcept(std::is_nothrow_assignable_v<typename SF::value_type&, T>)
         {
             target = source;
         }
@@ -24,7 +24,8 @@ struct none_impl
     static constexpr bool can_explicitly_cast_from = false;
     
     template<typename T>
-    static void cast_from(typename SF::value_type& target, T source)
+    static constexpr void cast_from(typename SF::value_type& target, T source)
+        noexcept(std::is_nothrow_assignable_v<typename SF::value_type&, T>)
     {
         target = source;
     }
@@ -52,7 +53,8 @@ struct same_impl
         is_explicit && std::is_same_v<typename SF::value_type, T>;
 
     template<typename T>
-    static void cast_from(typename SF::value_type& target, T source)
+    static constexpr void cast_from(typename SF::value_type& target, T source)
+        noexcept(std::is_nothrow_assignable_v<typename SF::value_type&, T>)
     {
         target = source;
     }
@@ -81,7 +83,8 @@ struct more_precise_impl
         is_explicit && std::is_floating_point_v<T> && std::numeric_limits<T>::digits >= std::numeric_limits<typename SF::value_type>::digits;
 
     template<typename T>
-    static void cast_from(typename SF::value_type& target, T source)
+    static constexpr void cast_from(typename SF::value_type& target, T source)
+        noexcept(std::is_nothrow_assignable_v<typename SF::value_type&, T>)
     {
         target = source;
     }
@@ -110,7 +113,8 @@ struct less_precise_impl
         is_explicit && std::is_floating_point_v<T>&& std::numeric_limits<T>::digits <= std::numeric_limits<typename SF::value_type>::digits;
 
     template<typename T>
-    static void cast_from(typename SF::value_type& target, T source)
+    static constexpr void cast_from(typename SF::value_type& target, T source)
+        noexcept(std::is_nothrow_assignable_v<typename SF::value_type&, T>)
     {
         target = source;
     }
@@ -137,7 +141,8 @@ struct all_impl
     static constexpr bool can_explicitly_cast_from = is_explicit && std::is_floating_point_v<T>;
 
     template<typename T>
-    static void cast_from(typename SF::value_type& target, T source)
+    static constexpr void cast_from(typename SF::value_type& target, T source)
+        noexcept(std::is_nothrow_assignable_v<typename SF::value_type&, T>)
     {
         target = source;
     }
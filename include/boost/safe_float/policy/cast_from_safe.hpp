@@ -66,7 +66,7 @@ struct cast_from_safe
             && !detail::can_cast_to<T, SF>::value; // Disable explicit construction from T if T can be implictly converted to SF
 
         template<typename T>
-        static void cast_from(typename SF::value_type& target, T source)
+        static constexpr void cast_from(typename SF::value_type& target, T source)
         {
             cast_helper<typename SF::value_type, FLOAT_CAST<SF>>::template construct_explicitly(
                 target, source.get_stored_value());
@@ -95,7 +95,7 @@ struct more_restrictive_impl
         is_explicit&& is_safe_float<T>::value&& is_subset<typename SF::check_policy, typename T::check_policy>::value;
 
     template<typename T>
-    static void cast_from(typename SF::value_type& target, T source)
+    static constexpr void cast_from(typename SF::value_type& target, T source)
     {
         target = source.get_stored_value();
     }
@@ -125,7 +125,7 @@ struct less_restrictive_impl
         is_explicit&& is_safe_float<T>::value&& is_subset<typename T::check_policy, typename SF::check_policy>::value;
 
     template<typename T>
-    static void cast_from(typename SF::value_type& target, T source)
+    static constexpr void cast_from(typename SF::value_type& target, T source)
     {
         target = source.get_stored_value();
     }
@@ -155,7 +155,7 @@ struct equivalent_impl
         is_equivalent<typename T::check_policy, typename SF::check_policy>::value;
 
     template<typename T>
-    static void cast_from(typename SF::value_type& target, T source)
+    static constexpr void cast_from(typename SF::value_type& target, T source)
     {
         target = source.get_stored_value();
     }
@@ -182,7 +182,7 @@ struct all_impl
     static constexpr bool can_explicitly_cast_from = is_explicit&& is_safe_float<T>::value;
 
     template<typename T>
-    static void cast_from(typename SF::value_type& target, T source)
+    static constexpr void cast_from(typename SF::value_type& target, T source)
     {
         target = source.get_stored_value();
     }
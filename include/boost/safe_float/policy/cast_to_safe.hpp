@@ -78,7 +78,7 @@ struct cast_to_safe
             && !detail::can_explicitly_cast_from<T, SF>::value; // Disable if T can already be constructed from SF
 
         template<typename T>
-        static T cast_to(typename SF::value_type source)
+        static constexpr T cast_to(typename SF::value_type source)
         {
             return T(cast_helper<typename SF::value_type, FLOAT_CAST<SF>>::template convert_explicitly(source));
         }
@@ -105,7 +105,7 @@ struct more_restrictive_impl
         is_explicit&& is_safe_float<T>::value&& is_subset<typename SF::check_policy, typename T::check_policy>::value;
 
     template<typename T>
-    static T cast_to(typename SF::value_type source)
+    static constexpr T cast_to(typename SF::value_type source)
     {
         return T(static_cast<typename T::value_type>(source.get_stored_value()));
     }
@@ -134,7 +134,7 @@ struct less_restrictive_impl
     static constexpr bool can_explicitly_cast_to = is_explicit&& is_safe_float<T>::value&& is_subset<typename T::check_policy, typename SF::check_policy>::value;
 
     template<typename T>
-    static T cast_to(typename SF::value_type source)
+    static constexpr T cast_to(typename SF::value_type source)
     {
         return T(static_cast<typename T::value_type>(source.get_stored_value()));
     }
@@ -164,7 +164,7 @@ struct equivalent_impl
                                                    is_equivalent<typename T::check_policy, typename SF::check_policy>::value;
 
     template<typename T>
-    static T cast_to(typename SF::value_type source)
+    static constexpr T cast_to(typename SF::value_type source)
     {
         return T(static_cast<typename T::value_type>(source.get_stored_value()));
     }
@@ -191,7 +191,7 @@ struct all_impl
     static constexpr bool can_explicitly_cast_to = is_explicit && is_safe_float<T>::value;
 
     template<typename T>
-    static T cast_to(typename SF::value_type source)
+    static constexpr T cast_to(typename SF::value_type source)
     {
         return T(static_cast<typename T::value_type>(source.get_stored_value()));
     }
@@ -1,10 +1,11 @@
 #ifndef BOOST_SAFE_FLOAT_POLICY_CHECK_ADDITION_OVERFLOW_HPP
 #define BOOST_SAFE_FLOAT_POLICY_CHECK_ADDITION_OVERFLOW_HPP
 #include <boost/safe_float/policy/check_base_policy.hpp>
+#include <boost/safe_float/detail/fenv_backend.hpp>
+#include <boost/safe_float/detail/ieee754.hpp>
 
-#ifdef FENV_AVAILABLE
+#ifdef BOOST_SAFE_FLOAT_FENV_ACCESS
 #pragma STDC FENV_ACCESS ON
-#include <fenv.h>
 #endif
 
 namespace boost {
@@ -15,22 +16,25 @@ template<class FP>
 class check_addition_overflow : public check_policy<FP> {
     bool precond=true;
 public:
-    bool pre_addition_check(const FP& lhs, const FP& rhs)
+    // precond is only kept by the value checks
+    static constexpr bool value_checks_state = true;
+
+    constexpr bool pre_addition_check(const FP& lhs, const FP& rhs) noexcept
     {
-#ifndef FENV_AVAILABLE
-        precond = std::isinf(lhs) || std::isinf(rhs);
-        return true;
-#else
-        return ! std::feclearexcept(FE_OVERFLOW);
-#endif
+        if (!boost::safe_float::detail::tests_fenv<FP>()) {
+            precond = boost::safe_float::detail::is_inf(lhs) | boost::safe_float::detail::is_inf(rhs);
+            return true;
+        } else {
+            return ! boost::safe_float::detail::fenv_backend<FP>::clearexcept(FE_OVERFLOW);
+        }
     }
-    bool post_addition_check(const FP& rhs)
+    constexpr bool post_addition_check(const FP& rhs) noexcept
     {
-#ifndef FENV_AVAILABLE
-        return precond || ! std::isinf(rhs);
-#else
-        return ! std::fetestexcept(FE_OVERFLOW);
-#endif
+        if (!boost::safe_float::detail::tests_fenv<FP>()) {
+            return ! boost::safe_float::detail::is_inf(rhs) || precond;
+        } else {
+            return ! boost::safe_float::detail::fenv_backend<FP>::testexcept(FE_OVERFLOW);
+        }
     }
     std::string addition_failure_message() { return std::string("Overflow to infinite on addition operation");
     }
@@ -8,6 +8,20 @@ namespace boost {
 namespace safe_float{
 namespace policy{
 
+// <cmath> functions with checked overloads, named in the messages of their checks
+enum class math_function { sqrt, exp, log, pow, hypot, atan2 };
+
+constexpr const char* function_name(math_function f) noexcept {
+    switch (f) {
+    case math_function::sqrt: return "sqrt";
+    case math_function::exp: return "exp";
+    case math_function::log: return "log";
+    case math_function::pow: return "pow";
+    case math_function::hypot: return "hypot";
+    default: return "atan2";
+    }
+}
+
 /**
  * Base policy for check
  */
@@ -22,6 +36,8 @@ public:
     std::string multiplication_failure_message() { return std::string("Failed to multiply"); }
     //operator/
     std::string division_failure_message() { return std::string("Failed to divide"); }
+    //<cmath> functions
+    std::string function_failure_message(math_function f) { return std::string("Failed to compute ") + function_name(f); }
 };
 
 } //policy
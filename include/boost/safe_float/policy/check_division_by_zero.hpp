@@ -2,10 +2,10 @@
 #define BOOST_SAFE_FLOAT_POLICY_CHECK_DIVISION_BY_ZERO_HPP
 
 #include <boost/safe_float/policy/check_base_policy.hpp>
+#include <boost/safe_float/detail/fenv_backend.hpp>
 
-#ifdef FENV_AVAILABLE
+#ifdef BOOST_SAFE_FLOAT_FENV_ACCESS
 #pragma STDC FENV_ACCESS ON
-#include <fenv.h>
 #endif
 
 namespace boost {
@@ -15,20 +15,20 @@ namespace policy{
 template<class FP>
 class check_division_by_zero : public check_policy<FP> {
 public:
-    bool pre_division_check(const FP& lhs, const FP& rhs){
-#ifndef FENV_AVAILABLE
-        return (rhs!=0);
-#else
-        return ! std::feclearexcept(FE_DIVBYZERO);
-#endif
+    constexpr bool pre_division_check(const FP& lhs, const FP& rhs) noexcept {
+        if (!boost::safe_float::detail::tests_fenv<FP>()) {
+            return (rhs!=0);
+        } else {
+            return ! boost::safe_float::detail::fenv_backend<FP>::clearexcept(FE_DIVBYZERO);
+        }
     }
 
-    bool post_division_check(const FP& rhs){
-#ifndef FENV_AVAILABLE
-        return true;
-#else
-        return ! std::fetestexcept(FE_DIVBYZERO);
-#endif
+    constexpr bool post_division_check(const FP& rhs) noexcept {
+        if (!boost::safe_float::detail::tests_fenv<FP>()) {
+            return true;
+        } else {
+            return ! boost::safe_float::detail::fenv_backend<FP>::testexcept(FE_DIVBYZERO);
+        }
     }
 
     std::string division_failure_message(){
@@ -2,10 +2,11 @@
 #define BOOST_SAFE_FLOAT_POLICY_CHECK_DIVISION_INEXACT_HPP
 
 #include <boost/safe_float/policy/check_base_policy.hpp>
+#include <boost/safe_float/detail/fenv_backend.hpp>
+#include <boost/safe_float/detail/ieee754.hpp>
 
-#ifdef FENV_AVAILABLE
+#ifdef BOOST_SAFE_FLOAT_FENV_ACCESS
 #pragma STDC FENV_ACCESS ON
-#include <fenv.h>
 #endif
 
 namespace boost {
@@ -14,27 +15,28 @@ namespace policy{
 
 template<class FP>
 class check_division_inexact : public check_policy<FP> {
-#ifndef FENV_AVAILABLE
     FP prev_l=0;
     FP prev_r=0;
-#endif
 public:
-    bool pre_division_check(const FP& lhs, const FP& rhs){
-#ifndef FENV_AVAILABLE
-        prev_l = lhs;
-        prev_r = rhs;
-        return true;
-#else
-        return ! std::feclearexcept(FE_INEXACT);
-#endif
+    // the operands are only kept by the value checks
+    static constexpr bool value_checks_state = true;
+
+    constexpr bool pre_division_check(const FP& lhs, const FP& rhs) noexcept {
+        if (!boost::safe_float::detail::tests_fenv<FP>()) {
+            prev_l = lhs;
+            prev_r = rhs;
+            return true;
+        } else {
+            return ! boost::safe_float::detail::fenv_backend<FP>::clearexcept(FE_INEXACT);
+        }
     }
 
-    bool post_division_check(const FP& rhs){
-#ifndef FENV_AVAILABLE
-        return ((rhs * prev_r) == prev_l); //this check is not completely safe, need to do some math to get a proper implementation...
-#else
-        return ! std::fetestexcept(FE_INEXACT);
-#endif
+    constexpr bool post_division_check(const FP& rhs) noexcept {
+        if (!boost::safe_float::detail::tests_fenv<FP>()) {
+            return boost::safe_float::detail::is_nan(rhs) || ((rhs * prev_r) == prev_l); //this check is not completely safe, need to do some math to get a proper implementation...
+        } else {
+            return ! boost::safe_float::detail::fenv_backend<FP>::testexcept(FE_INEXACT);
+        }
     }
 
     std::string division_failure_message(){
@@ -2,10 +2,11 @@
 #define BOOST_SAFE_FLOAT_POLICY_CHECK_DIVISION_OVERFLOW_HPP
 
 #include <boost/safe_float/policy/check_base_policy.hpp>
+#include <boost/safe_float/detail/fenv_backend.hpp>
+#include <boost/safe_float/detail/ieee754.hpp>
 
-#ifdef FENV_AVAILABLE
+#ifdef BOOST_SAFE_FLOAT_FENV_ACCESS
 #pragma STDC FENV_ACCESS ON
-#include <fenv.h>
 #endif
 
 namespace boost {
@@ -16,20 +17,23 @@ template<class FP>
 class check_division_overflow : public check_policy<FP> {
     bool precond=true;
 public:
-    bool pre_division_check(const FP& lhs, const FP& rhs){
-#ifndef FENV_AVAILABLE
-        precond = std::isinf(lhs) || std::isinf(rhs);
-        return true;
-#else
-        return ! std::feclearexcept(FE_OVERFLOW);
-#endif
+    // precond is only kept by the value checks
+    static constexpr bool value_checks_state = true;
+
+    constexpr bool pre_division_check(const FP& lhs, const FP& rhs) noexcept {
+        if (!boost::safe_float::detail::tests_fenv<FP>()) {
+            precond = boost::safe_float::detail::is_inf(lhs) | boost::safe_float::detail::is_inf(rhs);
+            return true;
+        } else {
+            return ! boost::safe_float::detail::fenv_backend<FP>::clearexcept(FE_OVERFLOW);
+        }
     }
-    bool post_division_check(const FP& rhs){
-#ifndef FENV_AVAILABLE
-        return precond || ! std::isinf(rhs);
-#else
-        return ! std::fetestexcept(FE_OVERFLOW);
-#endif
+    constexpr bool post_division_check(const FP& rhs) noexcept {
+        if (!boost::safe_float::detail::tests_fenv<FP>()) {
+            return ! boost::safe_float::detail::is_inf(rhs) || precond;
+        } else {
+            return ! boost::safe_float::detail::fenv_backend<FP>::testexcept(FE_OVERFLOW);
+        }
     }
     std::string division_failure_message(){
         return std::string("Overflow to infinite on division operation");
@@ -2,10 +2,11 @@
 #define BOOST_SAFE_FLOAT_POLICY_CHECK_DIVISION_UNDERFLOW_HPP
 
 #include <boost/safe_float/policy/check_base_policy.hpp>
+#include <boost/safe_float/detail/fenv_backend.hpp>
+#include <boost/safe_float/detail/ieee754.hpp>
 
-#ifdef FENV_AVAILABLE
+#ifdef BOOST_SAFE_FLOAT_FENV_ACCESS
 #pragma STDC FENV_ACCESS ON
-#include <fenv.h>
 #endif
 
 namespace boost {
@@ -14,26 +15,27 @@ namespace policy{
 
 template<class FP>
 class check_division_underflow : public check_policy<FP> {
-#ifndef FENV_AVAILABLE
-    bool expect_zero;
-#endif
+    bool expect_zero=false;
 public:
-    bool pre_division_check(const FP& lhs, const FP& rhs){
-#ifndef FENV_AVAILABLE
-        expect_zero = (lhs==0);
-        return true;
-#else
-        return ! std::feclearexcept(FE_UNDERFLOW);
-#endif
+    // expect_zero is only kept by the value checks
+    static constexpr bool value_checks_state = true;
+
+    constexpr bool pre_division_check(const FP& lhs, const FP& rhs) noexcept {
+        if (!boost::safe_float::detail::tests_fenv<FP>()) {
+            expect_zero = (lhs==0);
+            return true;
+        } else {
+            return ! boost::safe_float::detail::fenv_backend<FP>::clearexcept(FE_UNDERFLOW);
+        }
     }
 
-    bool post_division_check(const FP& rhs){
-#ifndef FENV_AVAILABLE
-        return (std::fpclassify( rhs ) != FP_SUBNORMAL)
-                && (rhs != 0 || expect_zero);
-#else
-        return ! std::fetestexcept(FE_UNDERFLOW);
-#endif
+    constexpr bool post_division_check(const FP& rhs) noexcept {
+        if (!boost::safe_float::detail::tests_fenv<FP>()) {
+            return (! boost::safe_float::detail::is_subnormal(rhs))
+                    && (rhs != 0 || expect_zero);
+        } else {
+            return ! boost::safe_float::detail::fenv_backend<FP>::testexcept(FE_UNDERFLOW);
+        }
     }
 
     std::string division_failure_message(){
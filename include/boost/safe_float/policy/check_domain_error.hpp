@@ -0,0 +1,48 @@
+#ifndef BOOST_SAFE_FLOAT_POLICY_CHECK_DOMAIN_ERROR_HPP
+#define BOOST_SAFE_FLOAT_POLICY_CHECK_DOMAIN_ERROR_HPP
+
+#include <boost/safe_float/policy/check_base_policy.hpp>
+#include <boost/safe_float/detail/ieee754.hpp>
+
+namespace boost {
+namespace safe_float{
+namespace policy{
+
+/**
+ * Checks the arguments of the <cmath> functions are in their domain: sqrt and log of negative values, pow of a
+ * negative base to a finite non integer exponent. The arguments are rejected before the function is computed,
+ * NaN results of arguments that are not NaN are reported after.
+ */
+template<class FP>
+class check_domain_error : public check_policy<FP> {
+public:
+    constexpr bool pre_function_check(math_function f, const FP& x, const FP& y) noexcept {
+        using boost::safe_float::detail::is_inf;
+        switch (f) {
+        case math_function::sqrt:
+        case math_function::log:
+            return !(x < 0);
+        case math_function::pow:
+            return !(x < 0) || is_inf(x) || is_inf(y) || boost::safe_float::detail::is_integral_value(y)
+                   || y != y;
+        default:
+            return true;
+        }
+    }
+
+    constexpr bool post_function_check(math_function, const FP& x, const FP& y, const FP& value) noexcept {
+        using boost::safe_float::detail::is_nan;
+        return !is_nan(value) || is_nan(x) || is_nan(y);
+    }
+
+    std::string function_failure_message(math_function f){
+        return std::string("Domain error in ") + function_name(f);
+    }
+
+};
+
+}
+}
+}
+
+#endif // BOOST_SAFE_FLOAT_POLICY_CHECK_DOMAIN_ERROR_HPP
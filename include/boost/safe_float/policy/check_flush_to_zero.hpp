@@ -0,0 +1,87 @@
+#ifndef BOOST_SAFE_FLOAT_POLICY_CHECK_FLUSH_TO_ZERO_HPP
+#define BOOST_SAFE_FLOAT_POLICY_CHECK_FLUSH_TO_ZERO_HPP
+
+#include <boost/safe_float/policy/check_base_policy.hpp>
+#include <boost/safe_float/detail/fenv_backend.hpp>
+#include <boost/safe_float/detail/ieee754.hpp>
+#include <boost/safe_float/flush_to_zero.hpp>
+
+namespace boost {
+namespace safe_float{
+namespace policy{
+
+/**
+ * Check the values flushed to zero inside a flush_to_zero_scope.
+ *
+ * For types computed by the SSE unit, a result flushed to zero is detected by the underflow flag and a
+ * subnormal operand read as zero is detected before the operation. Outside the scope, and for other types,
+ * it behaves as the underflow checks.
+ */
+template<class FP>
+class check_flush_to_zero : public check_policy<FP> {
+    using backend = typename boost::safe_float::detail::native_fenv_backend<FP>::type;
+    static constexpr bool on_sse = backend::kind == boost::safe_float::detail::fenv_backend_kind::sse;
+
+    // The underflow flag raised before the operation is cleared and recorded for flush_to_zero_scope::flushed(),
+    // the record is only set, so the checks give the same result when they run again to report a failure, or
+    // for each operation of a block. The modes don't apply to constant evaluation, where the values are checked
+    constexpr bool pre_check(const FP& lhs, const FP& rhs) noexcept {
+        if constexpr (on_sse) {
+            if (! BOOST_SAFE_FLOAT_IS_CONSTANT_EVALUATED()) {
+                unsigned const csr = backend::get_csr();
+                if (csr & backend::underflow) {
+                    boost::safe_float::detail::underflow_cleared() = true;
+                    backend::set_csr(csr & ~backend::underflow);
+                }
+                // comparisons read subnormals as zero in DAZ mode, the representation is tested instead
+                return !(csr & backend::denormals_are_zero)
+                       || !(boost::safe_float::detail::is_subnormal_representation(lhs)
+                            || boost::safe_float::detail::is_subnormal_representation(rhs));
+            }
+        }
+        return true;
+    }
+
+    constexpr bool post_check(const FP& value) noexcept {
+        if constexpr (on_sse) {
+            if (! BOOST_SAFE_FLOAT_IS_CONSTANT_EVALUATED()) {
+                return !(backend::get_csr() & backend::underflow)
+                       && !boost::safe_float::detail::is_subnormal(value);
+            }
+        }
+        return !boost::safe_float::detail::is_subnormal(value);
+    }
+
+public:
+    static constexpr bool reads_fenv_flags = on_sse;
+
+    constexpr bool pre_addition_check(const FP& lhs, const FP& rhs) noexcept { return pre_check(lhs, rhs); }
+    constexpr bool post_addition_check(const FP& value) noexcept { return post_check(value); }
+    std::string addition_failure_message(){
+        return std::string("Subnormal value flushed to zero on addition operation");
+    }
+
+    constexpr bool pre_subtraction_check(const FP& lhs, const FP& rhs) noexcept { return pre_check(lhs, rhs); }
+    constexpr bool post_subtraction_check(const FP& value) noexcept { return post_check(value); }
+    std::string subtraction_failure_message(){
+        return std::string("Subnormal value flushed to zero on subtraction operation");
+    }
+
+    constexpr bool pre_multiplication_check(const FP& lhs, const FP& rhs) noexcept { return pre_check(lhs, rhs); }
+    constexpr bool post_multiplication_check(const FP& value) noexcept { return post_check(value); }
+    std::string multiplication_failure_message(){
+        return std::string("Subnormal value flushed to zero on multiplication operation");
+    }
+
+    constexpr bool pre_division_check(const FP& lhs, const FP& rhs) noexcept { return pre_check(lhs, rhs); }
+    constexpr bool post_division_check(const FP& value) noexcept { return post_check(value); }
+    std::string division_failure_message(){
+        return std::string("Subnormal value flushed to zero on division operation");
+    }
+};
+
+}
+}
+}
+
+#endif // BOOST_SAFE_FLOAT_POLICY_CHECK_FLUSH_TO_ZERO_HPP
@@ -0,0 +1,68 @@
+#ifndef BOOST_SAFE_FLOAT_POLICY_CHECK_FUNCTION_INEXACT_HPP
+#define BOOST_SAFE_FLOAT_POLICY_CHECK_FUNCTION_INEXACT_HPP
+
+#include <cmath>
+
+#include <boost/safe_float/policy/check_base_policy.hpp>
+#include <boost/safe_float/detail/ieee754.hpp>
+
+namespace boost {
+namespace safe_float{
+namespace policy{
+
+/**
+ * Checks the finite results of the <cmath> functions are exact. Only sqrt is correctly rounded by every
+ * library, the results of the other functions are accepted when they are proven exact: exp(0), log(1), pow
+ * to the exponents 0, 1 and 2 and of the base 1, hypot of a zero argument or of squares summed exactly, and
+ * atan2 of zero over a positive value. Other results are reported, even when the library rounded them exactly.
+ * The flags are not read, the libraries don't specify the inexact exceptions the functions raise.
+ */
+template<class FP>
+class check_function_inexact : public check_policy<FP> {
+    // true when value * value is exactly x
+    static bool exact_square(const FP& value, const FP& x) noexcept {
+        return std::fma(value, value, -x) == 0;
+    }
+
+public:
+    bool post_function_check(math_function f, const FP& x, const FP& y, const FP& value) noexcept {
+        using boost::safe_float::detail::is_inf;
+        using boost::safe_float::detail::is_nan;
+        if (is_nan(value) || is_inf(value) || is_nan(x) || is_inf(x) || is_nan(y) || is_inf(y))
+            return true;
+        switch (f) {
+        case math_function::sqrt:
+            return exact_square(value, x);
+        case math_function::exp:
+            return x == 0;
+        case math_function::log:
+            return x == 1;
+        case math_function::pow:
+            return y == 0 || y == 1 || x == 1 || (y == 2 && exact_square(x, value));
+        case math_function::hypot: {
+            if (x == 0 || y == 0)
+                return true;
+            FP const xx = x * x;
+            FP const yy = y * y;
+            FP const sum = xx + yy;
+            // the rounding error of the sum, as computed by the two sum algorithm
+            FP const rounded = sum - xx;
+            FP const error = (xx - (sum - rounded)) + (yy - rounded);
+            return exact_square(x, xx) && exact_square(y, yy) && error == 0 && exact_square(value, sum);
+        }
+        default:
+            return x == 0 && !std::signbit(y);
+        }
+    }
+
+    std::string function_failure_message(math_function f){
+        return std::string("Inexact result of ") + function_name(f);
+    }
+
+};
+
+}
+}
+}
+
+#endif // BOOST_SAFE_FLOAT_POLICY_CHECK_FUNCTION_INEXACT_HPP
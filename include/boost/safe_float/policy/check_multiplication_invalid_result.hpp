@@ -2,12 +2,12 @@
 #define BOOST_SAFE_FLOAT_POLICY_CHECK_MULTIPLICATION_INVALID_RESULT_HPP
 
 #include <boost/safe_float/policy/check_base_policy.hpp>
+#include <boost/safe_float/detail/fenv_backend.hpp>
+#include <boost/safe_float/detail/ieee754.hpp>
+#include <cmath>
 
-#ifdef FENV_AVAILABLE
+#ifdef BOOST_SAFE_FLOAT_FENV_ACCESS
 #pragma STDC FENV_ACCESS ON
-#include <fenv.h>
-#else
-#include <cmath>
 #endif
 
 namespace boost {
@@ -17,19 +17,19 @@ namespace policy{
 template<class FP>
 class check_multiplication_invalid_result : public check_policy<FP> {
 public:
-    bool pre_multiplication_check(const FP& lhs, const FP& rhs){
-#ifndef FENV_AVAILABLE
-        return true;
-#else
-        return ! std::feclearexcept(FE_INVALID);
-#endif
+    constexpr bool pre_multiplication_check(const FP& lhs, const FP& rhs) noexcept {
+        if (!boost::safe_float::detail::tests_fenv<FP>()) {
+            return true;
+        } else {
+            return ! boost::safe_float::detail::fenv_backend<FP>::clearexcept(FE_INVALID);
+        }
     }
-    bool post_multiplication_check(const FP& rhs){
-#ifndef FENV_AVAILABLE
-        return !std::isnan(rhs);
-#else
-        return ! std::fetestexcept(FE_INVALID);
-#endif
+    constexpr bool post_multiplication_check(const FP& rhs) noexcept {
+        if (!boost::safe_float::detail::tests_fenv<FP>()) {
+            return !boost::safe_float::detail::is_nan(rhs);
+        } else {
+            return ! boost::safe_float::detail::fenv_backend<FP>::testexcept(FE_INVALID);
+        }
     }
     std::string multiplication_failure_message(){
         return std::string("Invalid result from arithmetic operation obtained");
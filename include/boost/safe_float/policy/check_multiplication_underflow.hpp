@@ -2,10 +2,11 @@
 #define BOOST_SAFE_FLOAT_POLICY_CHECK_MULTIPLICATION_UNDERFLOW_HPP
 
 #include <boost/safe_float/policy/check_base_policy.hpp>
+#include <boost/safe_float/detail/fenv_backend.hpp>
+#include <boost/safe_float/detail/ieee754.hpp>
 
-#ifdef FENV_AVAILABLE
+#ifdef BOOST_SAFE_FLOAT_FENV_ACCESS
 #pragma STDC FENV_ACCESS ON
-#include <fenv.h>
 #endif
 
 namespace boost {
@@ -15,20 +16,20 @@ namespace policy{
 template<class FP>
 class check_multiplication_underflow : public check_policy<FP> {
 public:
-    bool pre_multiplication_check(const FP& lhs, const FP& rhs){
-#ifndef FENV_AVAILABLE
-        return true;
-#else
-        return ! std::feclearexcept(FE_UNDERFLOW);
-#endif
+    constexpr bool pre_multiplication_check(const FP& lhs, const FP& rhs) noexcept {
+        if (!boost::safe_float::detail::tests_fenv<FP>()) {
+            return true;
+        } else {
+            return ! boost::safe_float::detail::fenv_backend<FP>::clearexcept(FE_UNDERFLOW);
+        }
     }
 
-    bool post_multiplication_check(const FP& rhs){
-#ifndef FENV_AVAILABLE
-        return std::fpclassify( rhs ) != FP_SUBNORMAL;
-#else
-        return ! std::fetestexcept(FE_UNDERFLOW);
-#endif
+    constexpr bool post_multiplication_check(const FP& rhs) noexcept {
+        if (!boost::safe_float::detail::tests_fenv<FP>()) {
+            return ! boost::safe_float::detail::is_subnormal(rhs);
+        } else {
+            return ! boost::safe_float::detail::fenv_backend<FP>::testexcept(FE_UNDERFLOW);
+        }
     }
 
     std::string multiplication_failure_message(){
@@ -0,0 +1,40 @@
+#ifndef BOOST_SAFE_FLOAT_POLICY_CHECK_POLE_ERROR_HPP
+#define BOOST_SAFE_FLOAT_POLICY_CHECK_POLE_ERROR_HPP
+
+#include <boost/safe_float/policy/check_base_policy.hpp>
+#include <boost/safe_float/detail/ieee754.hpp>
+
+namespace boost {
+namespace safe_float{
+namespace policy{
+
+/**
+ * Checks the arguments of the <cmath> functions are not at a pole, where the exact result is infinite: log of
+ * zero and pow of zero to a finite negative exponent. The arguments are rejected before the function is
+ * computed.
+ */
+template<class FP>
+class check_pole_error : public check_policy<FP> {
+public:
+    constexpr bool pre_function_check(math_function f, const FP& x, const FP& y) noexcept {
+        switch (f) {
+        case math_function::log:
+            return x != 0;
+        case math_function::pow:
+            return x != 0 || !(y < 0) || boost::safe_float::detail::is_inf(y);
+        default:
+            return true;
+        }
+    }
+
+    std::string function_failure_message(math_function f){
+        return std::string("Pole error in ") + function_name(f);
+    }
+
+};
+
+}
+}
+}
+
+#endif // BOOST_SAFE_FLOAT_POLICY_CHECK_POLE_ERROR_HPP
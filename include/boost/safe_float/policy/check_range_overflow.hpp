@@ -0,0 +1,36 @@
+#ifndef BOOST_SAFE_FLOAT_POLICY_CHECK_RANGE_OVERFLOW_HPP
+#define BOOST_SAFE_FLOAT_POLICY_CHECK_RANGE_OVERFLOW_HPP
+
+#include <boost/safe_float/policy/check_base_policy.hpp>
+#include <boost/safe_float/detail/ieee754.hpp>
+
+namespace boost {
+namespace safe_float{
+namespace policy{
+
+/**
+ * Checks the results of exp, pow and hypot of finite arguments are finite. The poles of pow, where the exact
+ * result is infinite, are left to check_pole_error.
+ */
+template<class FP>
+class check_range_overflow : public check_policy<FP> {
+public:
+    constexpr bool post_function_check(math_function f, const FP& x, const FP& y, const FP& value) noexcept {
+        using boost::safe_float::detail::is_inf;
+        using boost::safe_float::detail::is_nan;
+        if (!is_inf(value) || is_inf(x) || is_nan(x) || is_inf(y) || is_nan(y))
+            return true;
+        return !(f == math_function::exp || f == math_function::hypot || (f == math_function::pow && x != 0));
+    }
+
+    std::string function_failure_message(math_function f){
+        return std::string("Range overflow in ") + function_name(f);
+    }
+
+};
+
+}
+}
+}
+
+#endif // BOOST_SAFE_FLOAT_POLICY_CHECK_RANGE_OVERFLOW_HPP
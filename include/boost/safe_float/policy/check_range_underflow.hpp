@@ -0,0 +1,41 @@
+#ifndef BOOST_SAFE_FLOAT_POLICY_CHECK_RANGE_UNDERFLOW_HPP
+#define BOOST_SAFE_FLOAT_POLICY_CHECK_RANGE_UNDERFLOW_HPP
+
+#include <boost/safe_float/policy/check_base_policy.hpp>
+#include <boost/safe_float/detail/ieee754.hpp>
+
+namespace boost {
+namespace safe_float{
+namespace policy{
+
+/**
+ * Checks the results of the <cmath> functions of finite arguments neither are subnormal nor underflow to zero:
+ * exp of any argument, pow of a nonzero base and atan2 of a nonzero first argument are not exactly zero.
+ * Subnormal results equal to the magnitude of an argument, as hypot of a subnormal value and zero, are exact.
+ */
+template<class FP>
+class check_range_underflow : public check_policy<FP> {
+public:
+    constexpr bool post_function_check(math_function f, const FP& x, const FP& y, const FP& value) noexcept {
+        using boost::safe_float::detail::is_inf;
+        using boost::safe_float::detail::is_nan;
+        if (is_inf(x) || is_nan(x) || is_inf(y) || is_nan(y))
+            return true;
+        if (value == 0)
+            return !(f == math_function::exp || ((f == math_function::pow || f == math_function::atan2) && x != 0));
+        FP const magnitude = value < 0 ? -value : value;
+        return !boost::safe_float::detail::is_subnormal(value) || magnitude == (x < 0 ? -x : x)
+               || magnitude == (y < 0 ? -y : y);
+    }
+
+    std::string function_failure_message(math_function f){
+        return std::string("Range underflow in ") + function_name(f);
+    }
+
+};
+
+}
+}
+}
+
+#endif // BOOST_SAFE_FLOAT_POLICY_CHECK_RANGE_UNDERFLOW_HPP
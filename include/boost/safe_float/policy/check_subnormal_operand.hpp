@@ -0,0 +1,50 @@
+#ifndef BOOST_SAFE_FLOAT_POLICY_CHECK_SUBNORMAL_OPERAND_HPP
+#define BOOST_SAFE_FLOAT_POLICY_CHECK_SUBNORMAL_OPERAND_HPP
+
+#include <boost/safe_float/policy/check_base_policy.hpp>
+#include <boost/safe_float/detail/ieee754.hpp>
+
+namespace boost {
+namespace safe_float{
+namespace policy{
+
+/**
+ * Check no operand is subnormal before each operation.
+ *
+ * Operations on subnormal operands take the slow microcode assisted path on most hardware, combined with
+ * on_fail_count this policy measures how often it happens without stopping the computation.
+ */
+template<class FP>
+class check_subnormal_operand : public check_policy<FP> {
+    static constexpr bool normal_operands(const FP& lhs, const FP& rhs){
+        return ! boost::safe_float::detail::is_subnormal_representation(lhs)
+               && ! boost::safe_float::detail::is_subnormal_representation(rhs);
+    }
+
+public:
+    constexpr bool pre_addition_check(const FP& lhs, const FP& rhs) noexcept { return normal_operands(lhs, rhs); }
+    std::string addition_failure_message(){
+        return std::string("Subnormal operand on addition operation");
+    }
+
+    constexpr bool pre_subtraction_check(const FP& lhs, const FP& rhs) noexcept { return normal_operands(lhs, rhs); }
+    std::string subtraction_failure_message(){
+        return std::string("Subnormal operand on subtraction operation");
+    }
+
+    constexpr bool pre_multiplication_check(const FP& lhs, const FP& rhs) noexcept { return normal_operands(lhs, rhs); }
+    std::string multiplication_failure_message(){
+        return std::string("Subnormal operand on multiplication operation");
+    }
+
+    constexpr bool pre_division_check(const FP& lhs, const FP& rhs) noexcept { return normal_operands(lhs, rhs); }
+    std::string division_failure_message(){
+        return std::string("Subnormal operand on division operation");
+    }
+};
+
+}
+}
+}
+
+#endif // BOOST_SAFE_FLOAT_POLICY_CHECK_SUBNORMAL_OPERAND_HPP
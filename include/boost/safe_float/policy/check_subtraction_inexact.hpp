@@ -2,10 +2,11 @@
 #define BOOST_SAFE_FLOAT_POLICY_CHECK_SUBTRACTION_INEXACT_HPP
 
 #include <boost/safe_float/policy/check_base_policy.hpp>
+#include <boost/safe_float/detail/fenv_backend.hpp>
+#include <boost/safe_float/detail/ieee754.hpp>
 
-#ifdef FENV_AVAILABLE
+#ifdef BOOST_SAFE_FLOAT_FENV_ACCESS
 #pragma STDC FENV_ACCESS ON
-#include <fenv.h>
 #endif
 
 namespace boost {
@@ -14,29 +15,30 @@ namespace policy{
 
 template<class FP>
 class check_subtraction_inexact : public check_policy<FP> {
-#ifndef FENV_AVAILABLE
     FP prev_l=0;
     FP prev_r=0;
-#endif
 public:
-    bool pre_subtraction_check(const FP& lhs, const FP& rhs)
+    // the operands are only kept by the value checks
+    static constexpr bool value_checks_state = true;
+
+    constexpr bool pre_subtraction_check(const FP& lhs, const FP& rhs) noexcept
     {
-#ifndef FENV_AVAILABLE
-        prev_l = lhs;
-        prev_r = rhs;
-        return true;
-#else
-        return ! std::feclearexcept(FE_INEXACT);
-#endif
+        if (!boost::safe_float::detail::tests_fenv<FP>()) {
+            prev_l = lhs;
+            prev_r = rhs;
+            return true;
+        } else {
+            return ! boost::safe_float::detail::fenv_backend<FP>::clearexcept(FE_INEXACT);
+        }
     }
 
-    bool post_subtraction_check(const FP& rhs)
+    constexpr bool post_subtraction_check(const FP& rhs) noexcept
     {
-#ifndef FENV_AVAILABLE
-        return ((rhs + prev_r) == prev_l) && ((prev_l - rhs) == prev_r); //this check is not completely safe, need to do some math to get a proper implementation...
-#else
-        return ! std::fetestexcept(FE_INEXACT);
-#endif
+        if (!boost::safe_float::detail::tests_fenv<FP>()) {
+            return boost::safe_float::detail::is_nan(rhs) || (((rhs + prev_r) == prev_l) && ((prev_l - rhs) == prev_r)); //this check is not completely safe, need to do some math to get a proper implementation...
+        } else {
+            return ! boost::safe_float::detail::fenv_backend<FP>::testexcept(FE_INEXACT);
+        }
     }
 
     std::string subtraction_failure_message() { return std::string("Non reversible subtraction applied");
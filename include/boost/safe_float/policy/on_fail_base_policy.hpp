@@ -12,7 +12,7 @@ namespace policy{
  */
 class on_fail_policy {
 public:
-    void report_failure(const std::string& s) {}
+    void report_failure(const std::string& s) noexcept {}
 };
 
 } //policy
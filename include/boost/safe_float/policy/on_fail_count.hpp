@@ -0,0 +1,33 @@
+#ifndef BOOST_SAFE_FLOAT_POLICY_COUNT_ON_FAIL_HPP
+#define BOOST_SAFE_FLOAT_POLICY_COUNT_ON_FAIL_HPP
+#include <boost/safe_float/policy/on_fail_base_policy.hpp>
+
+namespace boost {
+namespace safe_float{
+namespace policy{
+
+/**
+ * @brief Counts the failures and continues the execution.
+ *
+ * The counter is kept by each thread, so counting does not synchronize the threads.
+ */
+class on_fail_count : public on_fail_policy {
+    static unsigned long long& counter() noexcept {
+        static thread_local unsigned long long failures = 0;
+        return failures;
+    }
+
+public:
+    void report_failure(const std::string&) noexcept { ++counter(); }
+
+    // failures reported by the current thread
+    static unsigned long long count() noexcept { return counter(); }
+    static void reset() noexcept { counter() = 0; }
+    // adds failures counted by other threads
+    static void add(unsigned long long failures) noexcept { counter() += failures; }
+};
+
+}
+}
+}
+#endif // BOOST_SAFE_FLOAT_POLICY_COUNT_ON_FAIL_HPP
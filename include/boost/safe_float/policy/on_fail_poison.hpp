@@ -0,0 +1,25 @@
+#ifndef BOOST_SAFE_FLOAT_POLICY_POISON_ON_FAIL_HPP
+#define BOOST_SAFE_FLOAT_POLICY_POISON_ON_FAIL_HPP
+#include <boost/safe_float/policy/on_fail_base_policy.hpp>
+
+namespace boost {
+namespace safe_float{
+namespace policy{
+
+/**
+ * @brief Marks the failing element invalid and continues the execution.
+ *
+ * Containers keeping the validity of their elements, as safe_vector, clear the bit of the element whose
+ * operation failed in place of reporting it. Other uses of the policy ignore the failures.
+ */
+class on_fail_poison : public on_fail_policy {
+public:
+    static constexpr bool poisons_elements = true;
+
+    void report_failure(const std::string&) noexcept {}
+};
+
+}
+}
+}
+#endif // BOOST_SAFE_FLOAT_POLICY_POISON_ON_FAIL_HPP
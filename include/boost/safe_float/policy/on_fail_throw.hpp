@@ -8,6 +8,9 @@ namespace policy{
 
 class on_fail_throw : public on_fail_policy {
 public:
+    // the failing operation doesn't return, what the checks reject is never computed upon
+    static constexpr bool stops_on_failure = true;
+
     void report_failure(const std::string& s) { throw std::runtime_error(s); }
 };
 
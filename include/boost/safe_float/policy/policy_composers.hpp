@@ -3,6 +3,7 @@
 
 #include <algorithm>
 
+#include <boost/safe_float/detail/fenv_backend.hpp>
 #include <boost/safe_float/policy/check_base_policy.hpp>
 #include <boost/safe_float/policy/policy_traits.hpp>
 #include <boost/safe_float/utility.hpp>
@@ -14,23 +15,64 @@ namespace safe_float
 {
 namespace policy
 {
+namespace detail
+{
+// Placeholder base of a policy without state
+template<class POLICY>
+struct stateless_component
+{};
+
+// Empty policies are not stored, so composing them keeps the safe_float standard layout
+template<class POLICY>
+using component_storage = std::conditional_t<std::is_empty_v<POLICY>, stateless_component<POLICY>, POLICY>;
+
+// Lets a temporary policy be passed where the stored ones are passed by reference, it lives until the end of
+// the full expression
+template<class T>
+constexpr T& as_lvalue(T&& value) noexcept
+{
+    return value;
+}
+} // namespace detail
+
 // check_composer
 template<class FP, template<class> class... As>
-class composed_check : private As<FP>...
+class composed_check : private detail::component_storage<As<FP>>...
 {
     // TODO add static check for As to be va;id check Policies.
     friend policy_traits<FP, composed_check, true>;
 
+    // The stored policy, or a new one when it is stateless
+    template<class POLICY>
+    constexpr decltype(auto) component() noexcept
+    {
+        if constexpr (std::is_empty_v<POLICY>)
+            return POLICY{};
+        else
+            return static_cast<POLICY&>(*this);
+    }
+
 public:
+    static constexpr bool reads_fenv_flags
+        = (boost::safe_float::detail::policy_reads_fenv_flags<As<FP>>::value || ... || false);
+
+    static constexpr bool value_checks_state
+        = ((std::is_empty_v<As<FP>> || boost::safe_float::detail::policy_value_checks_state<As<FP>>::value) && ...
+           && true);
+
     // operator+
-    bool pre_addition_check(const FP& lhs, const FP& rhs)
+    constexpr bool pre_addition_check(const FP& lhs, const FP& rhs) noexcept(
+        (policy_traits<FP, As<FP>>::nothrow_pre_addition_check() && ... && true))
     {
-        return (policy_traits<FP, As<FP>>::pre_addition_check(static_cast<As<FP>&>(*this), lhs, rhs) && ... && true);
+        return (policy_traits<FP, As<FP>>::pre_addition_check(detail::as_lvalue(component<As<FP>>()), lhs, rhs)
+                && ... && true);
     }
 
-    bool post_addition_check(const FP& value)
+    constexpr bool post_addition_check(const FP& value) noexcept(
+        (policy_traits<FP, As<FP>>::nothrow_post_addition_check() && ... && true))
     {
-        return (policy_traits<FP, As<FP>>::post_addition_check(static_cast<As<FP>&>(*this), value) && ... && true);
+        return (policy_traits<FP, As<FP>>::post_addition_check(detail::as_lvalue(component<As<FP>>()), value)
+                && ... && true);
     }
 
     std::string addition_failure_message()
@@ -40,14 +82,18 @@ public:
     }
 
     // operator-
-    bool pre_subtraction_check(const FP& lhs, const FP& rhs)
+    constexpr bool pre_subtraction_check(const FP& lhs, const FP& rhs) noexcept(
+        (policy_traits<FP, As<FP>>::nothrow_pre_subtraction_check() && ... && true))
     {
-        return (policy_traits<FP, As<FP>>::pre_subtraction_check(static_cast<As<FP>&>(*this), lhs, rhs) && ... && true);
+        return (policy_traits<FP, As<FP>>::pre_subtraction_check(detail::as_lvalue(component<As<FP>>()), lhs, rhs)
+                && ... && true);
     }
 
-    bool post_subtraction_check(const FP& value)
+    constexpr bool post_subtraction_check(const FP& value) noexcept(
+        (policy_traits<FP, As<FP>>::nothrow_post_subtraction_check() && ... && true))
     {
-        return (policy_traits<FP, As<FP>>::post_subtraction_check(static_cast<As<FP>&>(*this), value) && ... && true);
+        return (policy_traits<FP, As<FP>>::post_subtraction_check(detail::as_lvalue(component<As<FP>>()), value)
+                && ... && true);
     }
 
     std::string subtraction_failure_message()
@@ -57,16 +103,18 @@ public:
     }
 
     // operator*
-    bool pre_multiplication_check(const FP& lhs, const FP& rhs)
+    constexpr bool pre_multiplication_check(const FP& lhs, const FP& rhs) noexcept(
+        (policy_traits<FP, As<FP>>::nothrow_pre_multiplication_check() && ... && true))
     {
-        return (policy_traits<FP, As<FP>>::pre_multiplication_check(static_cast<As<FP>&>(*this), lhs, rhs) && ...
-                && true);
+        return (policy_traits<FP, As<FP>>::pre_multiplication_check(detail::as_lvalue(component<As<FP>>()), lhs, rhs)
+                && ... && true);
     }
 
-    bool post_multiplication_check(const FP& value)
+    constexpr bool post_multiplication_check(const FP& value) noexcept(
+        (policy_traits<FP, As<FP>>::nothrow_post_multiplication_check() && ... && true))
     {
-        return (policy_traits<FP, As<FP>>::post_multiplication_check(static_cast<As<FP>&>(*this), value) && ...
-                && true);
+        return (policy_traits<FP, As<FP>>::post_multiplication_check(detail::as_lvalue(component<As<FP>>()), value)
+                && ... && true);
     }
 
     std::string multiplication_failure_message()
@@ -76,14 +124,18 @@ public:
     }
 
     // operator/
-    bool pre_division_check(const FP& lhs, const FP& rhs)
+    constexpr bool pre_division_check(const FP& lhs, const FP& rhs) noexcept(
+        (policy_traits<FP, As<FP>>::nothrow_pre_division_check() && ... && true))
     {
-        return (policy_traits<FP, As<FP>>::pre_division_check(static_cast<As<FP>&>(*this), lhs, rhs) && ... && true);
+        return (policy_traits<FP, As<FP>>::pre_division_check(detail::as_lvalue(component<As<FP>>()), lhs, rhs)
+                && ... && true);
     }
 
-    bool post_division_check(const FP& value)
+    constexpr bool post_division_check(const FP& value) noexcept(
+        (policy_traits<FP, As<FP>>::nothrow_post_division_check() && ... && true))
     {
-        return (policy_traits<FP, As<FP>>::post_division_check(static_cast<As<FP>&>(*this), value) && ... && true);
+        return (policy_traits<FP, As<FP>>::post_division_check(detail::as_lvalue(component<As<FP>>()), value)
+                && ... && true);
     }
 
     std::string division_failure_message()
@@ -107,19 +159,33 @@ class policy_traits<FP, composed_check<FP, As...>, true> : public policy_traits<
     using parent = policy_traits<FP, composed_check<FP, As...>, false>;
 
 public:
-#define BOOST_SAFE_FLOAT_POLICY_REPORT_PRE_CHECK_ERROR(operation)                                  \
-    template<typename ERROR_HANDLING>                                                              \
-    static void report_pre_##operation(Policy& p, FP const& lhs, FP const& rhs, ERROR_HANDLING& e) \
-    {                                                                                              \
-        if constexpr (parent::has_pre_##operation##_check())                                       \
-        {                                                                                          \
-            (                                                                                      \
-                [&]() {                                                                            \
-                    auto& pol = static_cast<As<FP>&>(p);                                           \
-                    policy_traits<FP, As<FP>>::report_pre_##operation(pol, lhs, rhs, e);           \
-                }(),                                                                               \
-                ...);                                                                              \
-        }                                                                                          \
+// The composed check runs inline, the policies are checked again one by one to report their own message only
+// when it fails
+#define BOOST_SAFE_FLOAT_POLICY_REPORT_PRE_CHECK_ERROR(operation)                                                \
+    template<typename ERROR_HANDLING>                                                                            \
+    BOOST_SAFE_FLOAT_COLD static void report_pre_##operation##_failures(Policy& p, FP const& lhs, FP const& rhs, \
+                                                                        ERROR_HANDLING& e)                       \
+        noexcept((noexcept(policy_traits<FP, As<FP>>::report_pre_##operation(                                    \
+                      std::declval<As<FP>&>(), lhs, rhs, e))                                                     \
+                  && ...))                                                                                       \
+    {                                                                                                            \
+        (                                                                                                        \
+            [&]() {                                                                                              \
+                auto&& pol = p.template component<As<FP>>();                                                     \
+                policy_traits<FP, As<FP>>::report_pre_##operation(pol, lhs, rhs, e);                             \
+            }(),                                                                                                 \
+            ...);                                                                                                \
+    }                                                                                                            \
+                                                                                                                 \
+    template<typename ERROR_HANDLING>                                                                            \
+    static constexpr void report_pre_##operation(Policy& p, FP const& lhs, FP const& rhs, ERROR_HANDLING& e)     \
+        noexcept(noexcept(report_pre_##operation##_failures(p, lhs, rhs, e)))                                    \
+    {                                                                                                            \
+        if constexpr (parent::has_pre_##operation##_check())                                                     \
+        {                                                                                                        \
+            if (BOOST_SAFE_FLOAT_UNLIKELY(!p.pre_##operation##_check(lhs, rhs)))                                 \
+                report_pre_##operation##_failures(p, lhs, rhs, e);                                               \
+        }                                                                                                        \
     }
 
     BOOST_SAFE_FLOAT_POLICY_REPORT_PRE_CHECK_ERROR(addition)
@@ -129,19 +195,31 @@ public:
 
 #undef BOOST_SAFE_FLOAT_POLICY_REPORT_PRE_CHECK_ERROR
 
-#define BOOST_SAFE_FLOAT_POLICY_REPORT_POST_CHECK_ERROR(operation)                        \
-    template<typename ERROR_HANDLING>                                                     \
-    static void report_post_##operation(Policy& p, FP const& value, ERROR_HANDLING& e)    \
-    {                                                                                     \
-        if constexpr (parent::has_pre_##operation##_check())                              \
-        {                                                                                 \
-            (                                                                             \
-                [&]() {                                                                   \
-                    auto& pol = static_cast<As<FP>&>(p);                                  \
-                    policy_traits<FP, As<FP>>::report_post_##operation(pol, value, e); \
-                }(),                                                                      \
-                ...);                                                                     \
-        }                                                                                 \
+#define BOOST_SAFE_FLOAT_POLICY_REPORT_POST_CHECK_ERROR(operation)                                   \
+    template<typename ERROR_HANDLING>                                                                \
+    BOOST_SAFE_FLOAT_COLD static void report_post_##operation##_failures(Policy& p, FP const& value, \
+                                                                         ERROR_HANDLING& e)          \
+        noexcept((noexcept(policy_traits<FP, As<FP>>::report_post_##operation(                       \
+                      std::declval<As<FP>&>(), value, e))                                            \
+                  && ...))                                                                           \
+    {                                                                                                \
+        (                                                                                            \
+            [&]() {                                                                                  \
+                auto&& pol = p.template component<As<FP>>();                                         \
+                policy_traits<FP, As<FP>>::report_post_##operation(pol, value, e);                   \
+            }(),                                                                                     \
+            ...);                                                                                    \
+    }                                                                                                \
+                                                                                                     \
+    template<typename ERROR_HANDLING>                                                                \
+    static constexpr void report_post_##operation(Policy& p, FP const& value, ERROR_HANDLING& e)     \
+        noexcept(noexcept(report_post_##operation##_failures(p, value, e)))                          \
+    {                                                                                                \
+        if constexpr (parent::has_post_##operation##_check())                                        \
+        {                                                                                            \
+            if (BOOST_SAFE_FLOAT_UNLIKELY(!p.post_##operation##_check(value)))                       \
+                report_post_##operation##_failures(p, value, e);                                     \
+        }                                                                                            \
     }
 
     BOOST_SAFE_FLOAT_POLICY_REPORT_POST_CHECK_ERROR(addition)
@@ -189,7 +267,7 @@ template<typename FP, template<typename> typename FIRST, template<typename> type
 struct construct_implicit<FP, FIRST, REST...>
 {
     template<typename T>
-    static void construct(FP& target, T source)
+    static constexpr void construct(FP& target, T source)
     {
         if constexpr (FIRST<FP>::template can_cast_from<T>)
         {
@@ -206,7 +284,7 @@ template<typename FP>
 struct construct_implicit<FP>
 {
     template<typename T>
-    static void construct(FP& target, T source)
+    static constexpr void construct(FP& target, T source)
     {}
 };
 
@@ -218,7 +296,7 @@ template<typename FP, template<typename> typename FIRST, template<typename> type
 struct construct_explicit<FP, FIRST, REST...>
 {
     template<typename T>
-    static void construct(FP& target, T source)
+    static constexpr void construct(FP& target, T source)
     {
         if constexpr (FIRST<FP>::template can_cast_from<T> || FIRST<FP>::template can_explicitly_cast_from<T>)
         {
@@ -235,7 +313,7 @@ template<typename FP>
 struct construct_explicit<FP>
 {
     template<typename T>
-    static void construct(FP& target, T source)
+    static constexpr void construct(FP& target, T source)
     {}
 };
 } // namespace helper
@@ -246,23 +324,23 @@ struct cast_helper<FP, composed_cast<FP, As...>>
     using CAST_POLICY = composed_cast<FP, As...>;
 
     template<typename T, std::enable_if_t<CAST_POLICY::template can_cast_from<T>, int> = 0>
-    static void construct_implicitly(FP& target, T source)
+    static constexpr void construct_implicitly(FP& target, T source)
     {
         helper::construct_implicit<FP, As...>::template construct<T>(target, source);
     }
     template<typename T, std::enable_if_t<CAST_POLICY::template can_explicitly_cast_from<T>, int> = 0>
-    static void construct_explicitly(FP& target, T source)
+    static constexpr void construct_explicitly(FP& target, T source)
     {
         helper::construct_explicit<FP, As...>::template construct<T>(target, source);
     }
 
     template<typename T, std::enable_if_t<CAST_POLICY::template can_cast_from<T>, int> = 0>
-    static T convert_implicitly(FP source)
+    static constexpr T convert_implicitly(FP source)
     {
         CAST_POLICY::template cast_to<T>(source);
     }
     template<typename T, std::enable_if_t<CAST_POLICY::template can_explicitly_cast_from<T>, int> = 0>
-    static T convert_explicitly(FP source)
+    static constexpr T convert_explicitly(FP source)
     {
         CAST_POLICY::template cast_to<T>(source);
     }
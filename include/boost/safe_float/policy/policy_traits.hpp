@@ -2,8 +2,11 @@
 #define BOOST_SAFE_FLOAT_POLICY_TRAITS_HPP
 
 
+#include <string>
 #include <type_traits>
+#include <utility>
 
+#include <boost/safe_float/detail/config.hpp>
 
 namespace boost
 {
@@ -70,8 +73,41 @@ public:
 
 #undef BOOST_SAFE_FLOAT_TEST_POLICY_CAPACITY
 
+// A check missing in the policy never throws
+#define BOOST_SAFE_FLOAT_TEST_POLICY_NOTHROW_CHECK(capacity)                                             \
+    static constexpr bool nothrow_pre_##capacity##_check() noexcept                                      \
+    {                                                                                                    \
+        if constexpr (has_pre_##capacity##_check())                                                      \
+            return noexcept(std::declval<Policy&>().pre_##capacity##_check(std::declval<Fp const&>(),    \
+                                                                            std::declval<Fp const&>())); \
+        else                                                                                             \
+            return true;                                                                                 \
+    }                                                                                                    \
+    static constexpr bool nothrow_post_##capacity##_check() noexcept                                     \
+    {                                                                                                    \
+        if constexpr (has_post_##capacity##_check())                                                     \
+            return noexcept(std::declval<Policy&>().post_##capacity##_check(std::declval<Fp const&>())); \
+        else                                                                                             \
+            return true;                                                                                 \
+    }
+
+    BOOST_SAFE_FLOAT_TEST_POLICY_NOTHROW_CHECK(addition)
+    BOOST_SAFE_FLOAT_TEST_POLICY_NOTHROW_CHECK(subtraction)
+    BOOST_SAFE_FLOAT_TEST_POLICY_NOTHROW_CHECK(multiplication)
+    BOOST_SAFE_FLOAT_TEST_POLICY_NOTHROW_CHECK(division)
+
+#undef BOOST_SAFE_FLOAT_TEST_POLICY_NOTHROW_CHECK
+
+    // A report policy is nothrow when its report_failure is, a failure building the message terminates
+    template<typename ERROR_HANDLING>
+    static constexpr bool nothrow_report() noexcept
+    {
+        return noexcept(std::declval<ERROR_HANDLING&>().report_failure(std::declval<const std::string&>()));
+    }
+
 #define BOOST_SAFE_FLOAT_POLICY_DO_PRE_CHECK(capacity)                                         \
-    static bool pre_##capacity##_check(Policy& p, Fp const& lhs, Fp const& rhs)                \
+    static constexpr bool pre_##capacity##_check(Policy& p, Fp const& lhs, Fp const& rhs)      \
+        noexcept(nothrow_pre_##capacity##_check())                                             \
     {                                                                                          \
         if constexpr (has_pre_##capacity##_check()) return p.pre_##capacity##_check(lhs, rhs); \
         return true;                                                                           \
@@ -85,7 +121,8 @@ public:
 #undef BOOST_SAFE_FLOAT_POLICY_DO_PRE_CHECK
 
 #define BOOST_SAFE_FLOAT_POLICY_DO_POST_CHECK(capacity)                                       \
-    static bool post_##capacity##_check(Policy& p, Fp const& value)                           \
+    static constexpr bool post_##capacity##_check(Policy& p, Fp const& value)                 \
+        noexcept(nothrow_post_##capacity##_check())                                           \
     {                                                                                         \
         if constexpr (has_post_##capacity##_check()) return p.post_##capacity##_check(value); \
         return true;                                                                          \
@@ -98,14 +135,34 @@ public:
 
 #undef BOOST_SAFE_FLOAT_POLICY_DO_POST_CHECK
 
-#define BOOST_SAFE_FLOAT_POLICY_REPORT_PRE_CHECK_ERROR(operation)                                        \
-    template<typename ERROR_HANDLING>                                                                    \
-    static void report_pre_##operation(Policy& p, Fp const& lhs, Fp const& rhs, ERROR_HANDLING& e)       \
-    {                                                                                                    \
-        if constexpr (has_pre_##operation##_check())                                                     \
-        {                                                                                                \
-            if (!p.pre_##operation##_check(lhs, rhs)) e.report_failure(p.operation##_failure_message()); \
-        }                                                                                                \
+// Builds the message and reports it, kept out of line so the operators only hold the check and a branch.
+// It is not constexpr, a check failing during constant evaluation doesn't compile
+#define BOOST_SAFE_FLOAT_POLICY_REPORT_FAILURE(operation)                                        \
+    template<typename ERROR_HANDLING>                                                            \
+    BOOST_SAFE_FLOAT_COLD static void report_##operation##_failure(Policy& p, ERROR_HANDLING& e) \
+        noexcept(nothrow_report<ERROR_HANDLING>())                                               \
+    {                                                                                            \
+        e.report_failure(p.operation##_failure_message());                                       \
+    }
+
+    BOOST_SAFE_FLOAT_POLICY_REPORT_FAILURE(addition)
+    BOOST_SAFE_FLOAT_POLICY_REPORT_FAILURE(subtraction)
+    BOOST_SAFE_FLOAT_POLICY_REPORT_FAILURE(multiplication)
+    BOOST_SAFE_FLOAT_POLICY_REPORT_FAILURE(division)
+
+#undef BOOST_SAFE_FLOAT_POLICY_REPORT_FAILURE
+
+#define BOOST_SAFE_FLOAT_POLICY_REPORT_PRE_CHECK_ERROR(operation)                                            \
+    template<typename ERROR_HANDLING>                                                                        \
+    static constexpr void report_pre_##operation(Policy& p, Fp const& lhs, Fp const& rhs, ERROR_HANDLING& e) \
+        noexcept(!has_pre_##operation##_check()                                                              \
+                 || (nothrow_pre_##operation##_check() && nothrow_report<ERROR_HANDLING>()))                 \
+    {                                                                                                        \
+        if constexpr (has_pre_##operation##_check())                                                         \
+        {                                                                                                    \
+            if (BOOST_SAFE_FLOAT_UNLIKELY(!p.pre_##operation##_check(lhs, rhs)))                             \
+                report_##operation##_failure(p, e);                                                          \
+        }                                                                                                    \
     }
 
     BOOST_SAFE_FLOAT_POLICY_REPORT_PRE_CHECK_ERROR(addition)
@@ -115,14 +172,17 @@ public:
 
 #undef BOOST_SAFE_FLOAT_POLICY_REPORT_PRE_CHECK_ERROR
 
-#define BOOST_SAFE_FLOAT_POLICY_REPORT_POST_CHECK_ERROR(operation)                                     \
-    template<typename ERROR_HANDLING>                                                                  \
-    static void report_post_##operation(Policy& p, Fp const& value, ERROR_HANDLING& e)                 \
-    {                                                                                                  \
-        if constexpr (has_post_##operation##_check())                                                  \
-        {                                                                                              \
-            if (!p.post_##operation##_check(value)) e.report_failure(p.operation##_failure_message()); \
-        }                                                                                              \
+#define BOOST_SAFE_FLOAT_POLICY_REPORT_POST_CHECK_ERROR(operation)                               \
+    template<typename ERROR_HANDLING>                                                            \
+    static constexpr void report_post_##operation(Policy& p, Fp const& value, ERROR_HANDLING& e) \
+        noexcept(!has_post_##operation##_check()                                                 \
+                 || (nothrow_post_##operation##_check() && nothrow_report<ERROR_HANDLING>()))    \
+    {                                                                                            \
+        if constexpr (has_post_##operation##_check())                                            \
+        {                                                                                        \
+            if (BOOST_SAFE_FLOAT_UNLIKELY(!p.post_##operation##_check(value)))                   \
+                report_##operation##_failure(p, e);                                              \
+        }                                                                                        \
     }
 
     BOOST_SAFE_FLOAT_POLICY_REPORT_POST_CHECK_ERROR(addition)
@@ -1,8 +1,11 @@
-#ifndef PROMOTION_HPP
-#define PROMOTION_HPP
+#ifndef BOOST_SAFE_FLOAT_POLICY_PROMOTION_HPP
+#define BOOST_SAFE_FLOAT_POLICY_PROMOTION_HPP
 
+#include <limits>
+#include <type_traits>
 
 #include <boost/safe_float.hpp>
+#include <boost/safe_float/detail/check_filter.hpp>
 
 namespace boost
 {
@@ -10,19 +13,176 @@ namespace safe_float
 {
 namespace policy
 {
-    
+// The checks of both policies
+template<template<typename> typename CHECK1, template<typename> typename CHECK2>
+struct checks_union
+{
+    template<typename FP>
+    using policy = typename compose_check<CHECK1, CHECK2>::template policy<FP>;
+};
+
+namespace detail
+{
+template<typename FP, template<typename> typename CHECK2, typename KEPT, template<typename> typename... CHECKS>
+struct common_checks
+{
+    using type = KEPT;
+};
+
+template<typename FP, template<typename> typename CHECK2, template<typename> typename... KEPT,
+         template<typename> typename FIRST, template<typename> typename... REST>
+struct common_checks<FP, CHECK2, boost::safe_float::detail::kept_checks<KEPT...>, FIRST, REST...>
+{
+    using type = typename std::conditional_t<
+        is_subset<FIRST<FP>, CHECK2<FP>>::value,
+        common_checks<FP, CHECK2, boost::safe_float::detail::kept_checks<KEPT..., FIRST>, REST...>,
+        common_checks<FP, CHECK2, boost::safe_float::detail::kept_checks<KEPT...>, REST...>>::type;
+};
+
+template<typename FP, template<typename> typename CHECK2, typename FLAT>
+struct common_flattened;
+
+template<typename FP, template<typename> typename CHECK2, template<typename> typename... CHECKS>
+struct common_flattened<FP, CHECK2, flattened<CHECKS...>>
+{
+    using type = typename common_checks<FP, CHECK2, boost::safe_float::detail::kept_checks<>, CHECKS...>::type;
+};
+
+// Type of the values of both types, the one of more digits and exponents
+template<typename FP1, typename FP2>
+using promoted_value = std::conditional_t<(std::numeric_limits<FP1>::digits >= std::numeric_limits<FP2>::digits
+                                           && std::numeric_limits<FP1>::max_exponent
+                                                  >= std::numeric_limits<FP2>::max_exponent),
+                                          FP1, FP2>;
+
+// The report policy that declares it stops the failing operations, when only one of them does
+template<typename REPORT1, typename REPORT2>
+struct promoted_report
+{
+    static constexpr bool stops1 = boost::safe_float::detail::stops_on_failure<REPORT1>();
+    static constexpr bool stops2 = boost::safe_float::detail::stops_on_failure<REPORT2>();
+    static constexpr bool accepted = std::is_same<REPORT1, REPORT2>::value || stops1 != stops2;
+    using type = std::conditional_t<stops2 && !stops1, REPORT2, REPORT1>;
+};
+
+// A safe_float checking the checks of CHECK1 and CHECK2 combined, named by one of them when it holds the other
+template<typename FP, template<typename> typename CHECK1, template<typename> typename CHECK2,
+         template<typename> typename COMBINED, typename REPORT, template<typename> typename CAST>
+using combined_safe_float = std::conditional_t<
+    is_equivalent<COMBINED<FP>, CHECK1<FP>>::value, safe_float<FP, CHECK1, REPORT, CAST>,
+    std::conditional_t<is_equivalent<COMBINED<FP>, CHECK2<FP>>::value, safe_float<FP, CHECK2, REPORT, CAST>,
+                       safe_float<FP, COMBINED, REPORT, CAST>>>;
+} // namespace detail
+
+// The checks of the first policy the second one holds
+template<template<typename> typename CHECK1, template<typename> typename CHECK2>
+struct checks_intersection
+{
+    template<typename FP>
+    using policy = typename detail::common_flattened<
+        FP, CHECK2,
+        std::conditional_t<boost::safe_float::detail::is_flattened<typename flattener<composed_check>::template
+                                                                       flatten_composed<CHECK1<FP>>::type>::value,
+                           typename flattener<composed_check>::template flatten_composed<CHECK1<FP>>::type,
+                           flattened<CHECK1>>>::type::template policy<FP>;
+};
+
+/**
+ * Promotion of the operands of an operation between safe_float types. The promoted type holds the values of
+ * both, the widest of their value types, and checks what either of them checks, the union of their check
+ * policies; relaxed checks only what both of them check. The report policy is the one of both types, or the one
+ * stopping the failing operations when only one of them does; other report policies are not promoted. The cast
+ * policy is the one of both types, or the default one.
+ */
 template<typename, typename>
-struct promotion;
+struct promotion
+{
+    static constexpr bool accept_promotion = false;
+};
+
+template<typename FP1, template<typename> typename CHECK1, typename REPORT1, template<typename> typename CAST1,
+         typename FP2, template<typename> typename CHECK2, typename REPORT2, template<typename> typename CAST2>
+struct promotion<safe_float<FP1, CHECK1, REPORT1, CAST1>, safe_float<FP2, CHECK2, REPORT2, CAST2>>
+{
+private:
+    using value_type = detail::promoted_value<FP1, FP2>;
+    using report = typename detail::promoted_report<REPORT1, REPORT2>::type;
+
+    template<template<typename> typename COMBINED, template<typename> typename CAST>
+    using combined = detail::combined_safe_float<value_type, CHECK1, CHECK2, COMBINED, report, CAST>;
+
+    template<template<typename> typename COMBINED>
+    using with_cast = std::conditional_t<is_same_template<CAST1, CAST2>::value, combined<COMBINED, CAST1>,
+                                         combined<COMBINED, cast_from_primitive::same>>;
 
-template<typename FP, template<typename> typename CHECK, typename ERROR_HANDLING, template<typename> typename CAST>
-struct promotion<safe_float<FP, CHECK, ERROR_HANDLING, CAST>, safe_float<FP, CHECK, ERROR_HANDLING, CAST>> {
-    using promoted = safe_float<FP, CHECK, ERROR_HANDLING, CAST>;
-    
-    static constexpr bool accept_promotion = true;
+public:
+    using promoted = with_cast<checks_union<CHECK1, CHECK2>::template policy>;
+    using relaxed = with_cast<checks_intersection<CHECK1, CHECK2>::template policy>;
+
+    static constexpr bool accept_promotion = detail::promoted_report<REPORT1, REPORT2>::accepted;
 };
 
+} // namespace policy
+
+namespace detail
+{
+// Operations between different safe_float types are computed in their promotion
+template<typename SF1, typename SF2>
+struct mixed_operands : std::false_type
+{};
+
+template<typename FP1, template<typename> typename CHECK1, typename REPORT1, template<typename> typename CAST1,
+         typename FP2, template<typename> typename CHECK2, typename REPORT2, template<typename> typename CAST2>
+struct mixed_operands<safe_float<FP1, CHECK1, REPORT1, CAST1>, safe_float<FP2, CHECK2, REPORT2, CAST2>>
+    : std::integral_constant<bool, !std::is_same<safe_float<FP1, CHECK1, REPORT1, CAST1>,
+                                                 safe_float<FP2, CHECK2, REPORT2, CAST2>>::value
+                                       && policy::promotion<safe_float<FP1, CHECK1, REPORT1, CAST1>,
+                                                            safe_float<FP2, CHECK2, REPORT2, CAST2>>::accept_promotion>
+{};
+
+template<typename SF1, typename SF2>
+using promoted_t = typename policy::promotion<SF1, SF2>::promoted;
+
+// The value converted once to the promoted type, without going through its cast policy
+template<typename PROMOTED, typename SF>
+constexpr PROMOTED promote(const SF& value) noexcept
+{
+    PROMOTED promoted;
+    promoted.set_stored_value(static_cast<typename PROMOTED::value_type>(value.get_stored_value()));
+    return promoted;
 }
+} // namespace detail
+
+// mixed binary arithmetic operators, the operands are promoted and the operation checked in the promoted type
+#define BOOST_SAFE_FLOAT_MIXED_OPERATION(symbol)                                                                    \
+    template<typename SF1, typename SF2, std::enable_if_t<detail::mixed_operands<SF1, SF2>::value, int> = 0>        \
+    constexpr detail::promoted_t<SF1, SF2> operator symbol(const SF1& lhs, const SF2& rhs) noexcept(noexcept(       \
+        std::declval<detail::promoted_t<SF1, SF2>&>() symbol##= std::declval<const detail::promoted_t<SF1, SF2>&>())) \
+    {                                                                                                               \
+        detail::promoted_t<SF1, SF2> result = detail::promote<detail::promoted_t<SF1, SF2>>(lhs);                  \
+        result symbol##= detail::promote<detail::promoted_t<SF1, SF2>>(rhs);                                      \
+        return result;                                                                                              \
+    }                                                                                                               \
+                                                                                                                    \
+    /* the left operand keeps its type when it is the promoted one */                                              \
+    template<typename SF1, typename SF2,                                                                            \
+             std::enable_if_t<detail::mixed_operands<SF1, SF2>::value                                               \
+                                  && std::is_same<detail::promoted_t<SF1, SF2>, SF1>::value,                        \
+                              int> = 0>                                                                             \
+    constexpr SF1& operator symbol##=(SF1& lhs, const SF2& rhs) noexcept(                                          \
+        noexcept(lhs symbol##= std::declval<const SF1&>()))                                                        \
+    {                                                                                                               \
+        return lhs symbol##= detail::promote<SF1>(rhs);                                                           \
+    }
+
+BOOST_SAFE_FLOAT_MIXED_OPERATION(+)
+BOOST_SAFE_FLOAT_MIXED_OPERATION(-)
+BOOST_SAFE_FLOAT_MIXED_OPERATION(*)
+BOOST_SAFE_FLOAT_MIXED_OPERATION(/)
+
+#undef BOOST_SAFE_FLOAT_MIXED_OPERATION
+
 } // namespace safe_float
 } // namespace boost
 
-#endif // PROMOTION_HPP
\ No newline at end of file
+#endif // BOOST_SAFE_FLOAT_POLICY_PROMOTION_HPP
@@ -0,0 +1,247 @@
+#ifndef BOOST_SAFE_FLOAT_REFINED_HPP
+#define BOOST_SAFE_FLOAT_REFINED_HPP
+
+#include <functional>
+#include <limits>
+#include <type_traits>
+
+#include <boost/safe_float.hpp>
+#include <boost/safe_float/detail/check_filter.hpp>
+
+namespace boost
+{
+namespace safe_float
+{
+// Facts known of the values of a refined_safe_float
+namespace facts
+{
+constexpr unsigned none = 0;
+// neither infinite nor NaN
+constexpr unsigned finite = 1;
+constexpr unsigned nonzero = 2;
+// finite, nonzero and not subnormal
+constexpr unsigned normal = 4 | finite | nonzero;
+} // namespace facts
+
+template<class FP, unsigned FACTS, template<class T> class CHECK, class ERROR_HANDLING>
+class refined_safe_float;
+
+namespace detail
+{
+template<class FP>
+constexpr bool has_facts(FP value, unsigned known) noexcept
+{
+    if ((known & facts::finite) && (is_nan(value) || is_inf(value)))
+        return false;
+    if ((known & facts::nonzero) && value == 0) return false;
+    if ((known & facts::normal) == facts::normal && is_subnormal(value)) return false;
+    return true;
+}
+
+// The facts of a value proven by the checks of an operation of CHECK on operands of the facts given
+template<class FP, template<class> class CHECK, class ERROR_HANDLING, class OP, unsigned LHS, unsigned RHS>
+struct refined_operation
+{
+    static constexpr bool is_division = std::is_same<OP, std::divides<FP>>::value;
+    static constexpr bool finite_operands = (LHS & facts::finite) && (RHS & facts::finite);
+    static constexpr bool nonzero_divisor = is_division && (RHS & facts::nonzero);
+
+    // the facts only hold when the failures to refine the values stop the operation
+    static constexpr unsigned dropped
+        = !stops_on_failure<ERROR_HANDLING>()
+              ? 0u
+              : (finite_operands && (!is_division || (LHS & facts::nonzero) || (RHS & facts::nonzero))
+                     ? invalid_result_check
+                     : 0u)
+                    | (nonzero_divisor ? division_by_zero_check : 0u)
+                    | ((LHS & facts::normal) == facts::normal && (RHS & facts::normal) == facts::normal
+                           ? subnormal_operand_check
+                           : 0u);
+
+    using checks = dropped_checks<FP, CHECK, dropped>;
+
+    // the overflow check proves finite the results of finite operands, when the failures stop the operation
+    template<template<class> class OVERFLOW>
+    static constexpr bool checks_overflow = policy::is_subset<OVERFLOW<FP>, CHECK<FP>>::value;
+
+    static constexpr bool overflow_checked
+        = std::is_same<OP, std::plus<FP>>::value         ? checks_overflow<policy::check_addition_overflow>
+          : std::is_same<OP, std::minus<FP>>::value      ? checks_overflow<policy::check_subtraction_overflow>
+          : std::is_same<OP, std::multiplies<FP>>::value ? checks_overflow<policy::check_multiplication_overflow>
+                                                         : checks_overflow<policy::check_division_overflow>
+                                                               && (nonzero_divisor
+                                                                   || checks_overflow<policy::check_division_by_zero>);
+
+    static constexpr unsigned result
+        = stops_on_failure<ERROR_HANDLING>() && finite_operands && overflow_checked ? facts::finite : facts::none;
+};
+
+} // namespace detail
+
+/**
+ * A value of FP known to have the facts FACTS: finite, nonzero or normal. The operations between refined values
+ * drop the checks of CHECK the facts of their operands make redundant: the invalid result checks of finite
+ * operands, unless zero may be divided by zero, the division by zero checks of nonzero divisors and the subnormal
+ * operand checks of normal operands. Their results are finite when the operands are finite, the overflow of the
+ * operation is checked and ERROR_HANDLING stops the operations that fail, which a report policy declares with a
+ * static constexpr bool stops_on_failure, as on_fail_throw does.
+ *
+ * Values are refined by checking their facts, the failures are reported to ERROR_HANDLING. When it stops the
+ * operation the facts hold, and the optimizer is told so; otherwise the value is kept after its failure is
+ * reported, and the operations on refined values run all the checks of CHECK.
+ */
+template<class FP, unsigned FACTS, template<class T> class CHECK = policy::check_all,
+         class ERROR_HANDLING = policy::on_fail_throw>
+class refined_safe_float
+{
+    FP number;
+
+    template<class, unsigned, template<class> class, class>
+    friend class refined_safe_float;
+
+    struct unchecked
+    {};
+
+    constexpr refined_safe_float(unchecked, FP value) noexcept : number(value) {}
+
+    BOOST_SAFE_FLOAT_COLD static void report_missing_facts(FP value)
+    {
+        ERROR_HANDLING handler;
+        if ((FACTS & facts::finite) && !detail::has_facts(value, facts::finite))
+            handler.report_failure("Value is not finite");
+        else if ((FACTS & facts::nonzero) && value == 0)
+            handler.report_failure("Value is zero");
+        else
+            handler.report_failure("Value is subnormal");
+    }
+
+    static constexpr void check_facts(FP value)
+    {
+        if (BOOST_SAFE_FLOAT_UNLIKELY(!detail::has_facts(value, FACTS))) report_missing_facts(value);
+    }
+
+    // The facts hold when the failures to refine the value stop the operation
+    constexpr FP known_value() const noexcept
+    {
+        if constexpr (detail::stops_on_failure<ERROR_HANDLING>() && FACTS != facts::none)
+            BOOST_SAFE_FLOAT_ASSUME(detail::has_facts(number, FACTS));
+        return number;
+    }
+
+    template<class OP, unsigned RHS_FACTS>
+    using operation = detail::refined_operation<FP, CHECK, ERROR_HANDLING, OP, FACTS, RHS_FACTS>;
+
+    template<class OP, unsigned RHS_FACTS>
+    using result = refined_safe_float<FP, operation<OP, RHS_FACTS>::result, CHECK, ERROR_HANDLING>;
+
+    template<class OP, unsigned RHS_FACTS>
+    static constexpr FP checked_apply(FP lhs, FP rhs) noexcept(
+        detail::nothrow_checked_apply<FP, typename operation<OP, RHS_FACTS>::checks, ERROR_HANDLING, OP>())
+    {
+        return detail::checked_apply<FP, typename operation<OP, RHS_FACTS>::checks, ERROR_HANDLING>(lhs, rhs, OP{});
+    }
+
+public:
+    using value_type = FP;
+    using report_policy = ERROR_HANDLING;
+    static constexpr unsigned known_facts = FACTS;
+
+    // The checks an operation with a right operand of the facts RHS_FACTS runs
+    template<class OP, unsigned RHS_FACTS = FACTS>
+    using operation_checks = typename operation<OP, RHS_FACTS>::checks;
+
+    static_assert(std::is_floating_point<FP>::value,
+                  "First template parameter in refined_safe_float has to be floating point data type");
+
+    constexpr explicit refined_safe_float(FP value) : number(value) { check_facts(value); }
+
+    // Values of more facts convert implicitly and unchecked, the others explicitly with a check
+    template<unsigned OTHER_FACTS, std::enable_if_t<(OTHER_FACTS & FACTS) == FACTS, int> = 0>
+    constexpr refined_safe_float(const refined_safe_float<FP, OTHER_FACTS, CHECK, ERROR_HANDLING>& other) noexcept
+        : number(other.number)
+    {}
+
+    template<unsigned OTHER_FACTS, std::enable_if_t<(OTHER_FACTS & FACTS) != FACTS, int> = 0>
+    constexpr explicit refined_safe_float(const refined_safe_float<FP, OTHER_FACTS, CHECK, ERROR_HANDLING>& other)
+        : number(other.number)
+    {
+        check_facts(number);
+    }
+
+    template<template<class T> class CAST>
+    constexpr explicit refined_safe_float(const safe_float<FP, CHECK, ERROR_HANDLING, CAST>& value)
+        : number(value.get_stored_value())
+    {
+        check_facts(number);
+    }
+
+    constexpr FP get_stored_value() const noexcept { return known_value(); }
+
+    // The value as a safe_float, its operations check every check of CHECK
+    constexpr operator safe_float<FP, CHECK, ERROR_HANDLING>() const noexcept
+    {
+        return safe_float<FP, CHECK, ERROR_HANDLING>(number);
+    }
+
+#define BOOST_SAFE_FLOAT_REFINED_OPERATION(symbol, OP)                                                             \
+    template<unsigned RHS_FACTS>                                                                                  \
+    constexpr result<OP<FP>, RHS_FACTS> operator symbol(                                                          \
+        const refined_safe_float<FP, RHS_FACTS, CHECK, ERROR_HANDLING>& rhs) const                                \
+        noexcept(noexcept(checked_apply<OP<FP>, RHS_FACTS>(FP(), FP())))                                          \
+    {                                                                                                             \
+        return result<OP<FP>, RHS_FACTS>(typename result<OP<FP>, RHS_FACTS>::unchecked{},                        \
+                                         checked_apply<OP<FP>, RHS_FACTS>(known_value(), rhs.known_value()));     \
+    }                                                                                                             \
+                                                                                                                  \
+    template<template<class T> class CAST>                                                                        \
+    constexpr result<OP<FP>, facts::none> operator symbol(const safe_float<FP, CHECK, ERROR_HANDLING, CAST>& rhs) \
+        const noexcept(noexcept(checked_apply<OP<FP>, facts::none>(FP(), FP())))                                  \
+    {                                                                                                             \
+        return result<OP<FP>, facts::none>(typename result<OP<FP>, facts::none>::unchecked{},                     \
+                                           checked_apply<OP<FP>, facts::none>(known_value(),                      \
+                                                                              rhs.get_stored_value()));           \
+    }                                                                                                             \
+                                                                                                                  \
+    template<template<class T> class CAST>                                                                        \
+    friend constexpr refined_safe_float<FP, facts::none, CHECK, ERROR_HANDLING> operator symbol(                  \
+        const safe_float<FP, CHECK, ERROR_HANDLING, CAST>& lhs, const refined_safe_float& rhs)                    \
+    {                                                                                                             \
+        return refined_safe_float<FP, facts::none, CHECK, ERROR_HANDLING>(lhs) symbol rhs;                        \
+    }
+
+    BOOST_SAFE_FLOAT_REFINED_OPERATION(+, std::plus)
+    BOOST_SAFE_FLOAT_REFINED_OPERATION(-, std::minus)
+    BOOST_SAFE_FLOAT_REFINED_OPERATION(*, std::multiplies)
+    BOOST_SAFE_FLOAT_REFINED_OPERATION(/, std::divides)
+
+#undef BOOST_SAFE_FLOAT_REFINED_OPERATION
+};
+
+template<class FP, template<class T> class CHECK = policy::check_all, class ERROR_HANDLING = policy::on_fail_throw>
+using finite_safe_float = refined_safe_float<FP, facts::finite, CHECK, ERROR_HANDLING>;
+
+template<class FP, template<class T> class CHECK = policy::check_all, class ERROR_HANDLING = policy::on_fail_throw>
+using nonzero_safe_float = refined_safe_float<FP, facts::nonzero, CHECK, ERROR_HANDLING>;
+
+template<class FP, template<class T> class CHECK = policy::check_all, class ERROR_HANDLING = policy::on_fail_throw>
+using normal_safe_float = refined_safe_float<FP, facts::normal, CHECK, ERROR_HANDLING>;
+
+// Checks the facts of a value, its failures are reported to the report policy of the value
+template<unsigned FACTS, class FP, template<class T> class CHECK, class ERROR_HANDLING, template<class T> class CAST>
+constexpr refined_safe_float<FP, FACTS, CHECK, ERROR_HANDLING> refine(
+    const safe_float<FP, CHECK, ERROR_HANDLING, CAST>& value)
+{
+    return refined_safe_float<FP, FACTS, CHECK, ERROR_HANDLING>(value);
+}
+
+template<unsigned FACTS, class FP, unsigned OTHER_FACTS, template<class T> class CHECK, class ERROR_HANDLING>
+constexpr refined_safe_float<FP, FACTS | OTHER_FACTS, CHECK, ERROR_HANDLING> refine(
+    const refined_safe_float<FP, OTHER_FACTS, CHECK, ERROR_HANDLING>& value)
+{
+    return refined_safe_float<FP, FACTS | OTHER_FACTS, CHECK, ERROR_HANDLING>(value);
+}
+
+} // namespace safe_float
+} // namespace boost
+
+#endif // BOOST_SAFE_FLOAT_REFINED_HPP
@@ -0,0 +1,180 @@
+#ifndef BOOST_SAFE_FLOAT_ROUNDING_HPP
+#define BOOST_SAFE_FLOAT_ROUNDING_HPP
+
+#include <cfenv>
+
+#include <boost/safe_float/detail/fenv_backend.hpp>
+
+#if defined(BOOST_SAFE_FLOAT_HAS_SSE_FLOAT) || defined(BOOST_SAFE_FLOAT_HAS_SSE_DOUBLE)
+#define BOOST_SAFE_FLOAT_HAS_SSE_ROUNDING
+#endif
+
+namespace boost
+{
+namespace safe_float
+{
+/**
+ * Rounding directions, the values are the encoding of the rounding control of the SSE and x87 units.
+ */
+enum class rounding_mode { to_nearest = 0, downward = 1, upward = 2, toward_zero = 3 };
+
+namespace detail
+{
+#if defined(BOOST_SAFE_FLOAT_HAS_SSE_ROUNDING)
+struct sse_rounding
+{
+    using backend = sse_fenv_backend;
+    using control_type = unsigned;
+    static control_type get() { return backend::get_csr(); }
+    static void set(control_type csr) { backend::set_csr(csr); }
+    static constexpr control_type mask = backend::rounding_control;
+    static constexpr unsigned shift = backend::rounding_shift;
+};
+#endif
+
+#if defined(BOOST_SAFE_FLOAT_HAS_X87_ASM)
+struct x87_rounding
+{
+    using backend = x87_fenv_backend;
+    using control_type = unsigned short;
+    static control_type get() { return backend::get_control(); }
+    static void set(control_type cw) { backend::set_control(cw); }
+    static constexpr control_type mask = backend::rounding_control;
+    static constexpr unsigned shift = backend::rounding_shift;
+};
+#endif
+
+// Rounding control of a single unit, written only when the mode differs
+template<class UNIT>
+class unit_rounding_scope
+{
+    using control_type = typename UNIT::control_type;
+    control_type saved_rounding = 0;
+    bool changed = false;
+
+public:
+    explicit unit_rounding_scope(rounding_mode mode)
+    {
+        control_type const control = UNIT::get();
+        control_type const requested = static_cast<control_type>(static_cast<unsigned>(mode) << UNIT::shift);
+        saved_rounding = control & UNIT::mask;
+        if (saved_rounding != requested)
+        {
+            UNIT::set(static_cast<control_type>((control & ~UNIT::mask) | requested));
+            changed = true;
+        }
+    }
+
+    ~unit_rounding_scope()
+    {
+        // only the rounding control is restored, the flags raised inside the scope are kept
+        if (changed) UNIT::set(static_cast<control_type>((UNIT::get() & ~UNIT::mask) | saved_rounding));
+    }
+
+    static rounding_mode current() { return static_cast<rounding_mode>((UNIT::get() & UNIT::mask) >> UNIT::shift); }
+};
+
+// Portable implementation relying on libc
+class libc_rounding_scope
+{
+    int saved_rounding;
+    bool changed = false;
+
+    static int to_libc(rounding_mode mode)
+    {
+        switch (mode)
+        {
+        case rounding_mode::downward: return FE_DOWNWARD;
+        case rounding_mode::upward: return FE_UPWARD;
+        case rounding_mode::toward_zero: return FE_TOWARDZERO;
+        default: return FE_TONEAREST;
+        }
+    }
+
+public:
+    explicit libc_rounding_scope(rounding_mode mode) : saved_rounding(std::fegetround())
+    {
+        if (saved_rounding != to_libc(mode)) changed = (std::fesetround(to_libc(mode)) == 0);
+    }
+
+    ~libc_rounding_scope()
+    {
+        if (changed) std::fesetround(saved_rounding);
+    }
+
+    static rounding_mode current()
+    {
+        switch (std::fegetround())
+        {
+        case FE_DOWNWARD: return rounding_mode::downward;
+        case FE_UPWARD: return rounding_mode::upward;
+        case FE_TOWARDZERO: return rounding_mode::toward_zero;
+        default: return rounding_mode::to_nearest;
+        }
+    }
+};
+} // namespace detail
+
+/**
+ * Scope setting the rounding direction of the floating point operations.
+ *
+ * The rounding control of each unit is read when the scope starts and it is only written when it differs
+ * from the requested mode, so nested scopes with the same mode, or scopes entered repeatedly in a loop while
+ * an outer scope holds the mode, cost a read of the control registers. The previous mode is restored at the
+ * end of the scope.
+ *
+ * The compiler assumes operations round to nearest when it evaluates them at compile time, code using
+ * directed rounding on constants needs -frounding-math or the flags based checks.
+ */
+class rounding_scope
+{
+#if defined(BOOST_SAFE_FLOAT_HAS_SSE_ROUNDING)
+    detail::unit_rounding_scope<detail::sse_rounding> sse;
+#endif
+#if defined(BOOST_SAFE_FLOAT_HAS_X87_ASM)
+    detail::unit_rounding_scope<detail::x87_rounding> x87;
+#endif
+#if !defined(BOOST_SAFE_FLOAT_HAS_SSE_ROUNDING) && !defined(BOOST_SAFE_FLOAT_HAS_X87_ASM)
+    detail::libc_rounding_scope libc;
+#endif
+
+public:
+    explicit rounding_scope(rounding_mode mode)
+#if defined(BOOST_SAFE_FLOAT_HAS_SSE_ROUNDING) && defined(BOOST_SAFE_FLOAT_HAS_X87_ASM)
+        : sse(mode), x87(mode)
+#elif defined(BOOST_SAFE_FLOAT_HAS_SSE_ROUNDING)
+        : sse(mode)
+#elif defined(BOOST_SAFE_FLOAT_HAS_X87_ASM)
+        : x87(mode)
+#else
+        : libc(mode)
+#endif
+    {
+    }
+
+    rounding_scope(const rounding_scope&) = delete;
+    rounding_scope& operator=(const rounding_scope&) = delete;
+
+    // rounding direction of the unit computing FP
+    template<class FP = double>
+    static rounding_mode current()
+    {
+#if defined(BOOST_SAFE_FLOAT_HAS_SSE_ROUNDING) && defined(BOOST_SAFE_FLOAT_HAS_X87_ASM)
+        if constexpr (detail::native_fenv_backend<FP>::type::kind == detail::fenv_backend_kind::x87)
+            return detail::unit_rounding_scope<detail::x87_rounding>::current();
+        else
+            return detail::unit_rounding_scope<detail::sse_rounding>::current();
+#elif defined(BOOST_SAFE_FLOAT_HAS_SSE_ROUNDING)
+        return detail::unit_rounding_scope<detail::sse_rounding>::current();
+#elif defined(BOOST_SAFE_FLOAT_HAS_X87_ASM)
+        return detail::unit_rounding_scope<detail::x87_rounding>::current();
+#else
+        return detail::libc_rounding_scope::current();
+#endif
+    }
+};
+
+} // namespace safe_float
+} // namespace boost
+
+#endif // BOOST_SAFE_FLOAT_ROUNDING_HPP
@@ -0,0 +1,161 @@
+#ifndef BOOST_SAFE_FLOAT_SAFE_REF_HPP
+#define BOOST_SAFE_FLOAT_SAFE_REF_HPP
+
+#include <functional>
+#include <utility>
+
+#include <boost/safe_float.hpp>
+
+namespace boost
+{
+namespace safe_float
+{
+/**
+ * Reference to an existing FP lvalue, checking the compound assignments applied through it.
+ *
+ * The operations read the referenced value, check them with CHECK and report failures with ERROR_HANDLING
+ * as safe_float does, and write the result back in place. Assigning a value or another safe_ref writes the
+ * referenced value, copies of a safe_ref refer to the same value. Each operation runs its checks on a new
+ * check policy, as safe_float does.
+ */
+template<class FP, template<class T> class CHECK = policy::check_all, class ERROR_HANDLING = policy::on_fail_throw>
+class safe_ref : private ERROR_HANDLING
+{
+    FP& number;
+
+    using pol = CHECK<FP>;
+    using traits = policy::policy_traits<FP, CHECK<FP>>;
+    constexpr ERROR_HANDLING& handler() noexcept { return static_cast<ERROR_HANDLING&>(*this); }
+
+#define BOOST_SAFE_FLOAT_NOTHROW_OPERATION(operation)                                                        \
+    static constexpr bool nothrow_##operation =                                                              \
+        noexcept(traits::report_pre_##operation(std::declval<pol&>(), std::declval<const FP&>(),             \
+                                                std::declval<const FP&>(), std::declval<ERROR_HANDLING&>())) \
+        && noexcept(traits::report_post_##operation(std::declval<pol&>(), std::declval<const FP&>(),         \
+                                                    std::declval<ERROR_HANDLING&>()));
+
+    BOOST_SAFE_FLOAT_NOTHROW_OPERATION(addition)
+    BOOST_SAFE_FLOAT_NOTHROW_OPERATION(subtraction)
+    BOOST_SAFE_FLOAT_NOTHROW_OPERATION(multiplication)
+    BOOST_SAFE_FLOAT_NOTHROW_OPERATION(division)
+
+#undef BOOST_SAFE_FLOAT_NOTHROW_OPERATION
+
+    // Applies the operation, when checks rely on flags it is kept between the pre and post checks
+    template<typename OP>
+    static constexpr FP apply(FP lhs, FP rhs, OP op)
+    {
+        return detail::ordered_apply<FP, pol>(lhs, rhs, op);
+    }
+
+public:
+    using value_type = FP;
+    using check_policy = pol;
+    using report_policy = ERROR_HANDLING;
+
+    static_assert(std::is_floating_point<FP>::value,
+                  "First template parameter in safe_ref has to be floating point data type");
+
+    constexpr explicit safe_ref(FP& referenced) noexcept : number(referenced) {}
+
+    constexpr safe_ref(const safe_ref&) noexcept = default;
+
+    // Assignments write the referenced value
+    constexpr safe_ref& operator=(const safe_ref& other) noexcept
+    {
+        number = other.number;
+        return *this;
+    }
+
+    constexpr safe_ref& operator=(FP value) noexcept
+    {
+        number = value;
+        return *this;
+    }
+
+    // Access to the referenced value
+    constexpr FP get_stored_value() const noexcept { return number; }
+    constexpr void set_stored_value(FP f) noexcept { number = f; }
+    constexpr operator FP() const noexcept { return number; }
+
+    // compound assignments, the result is written in place
+    constexpr safe_ref& operator+=(FP rhs) noexcept(nothrow_addition)
+    {
+        FP const lhs = number;
+        pol checks{};
+        traits::report_pre_addition(checks, lhs, rhs, handler()); // early error detection
+        number = apply(lhs, rhs, std::plus<FP>{});
+        traits::report_post_addition(checks, number, handler());
+        return *this;
+    }
+
+    constexpr safe_ref& operator-=(FP rhs) noexcept(nothrow_subtraction)
+    {
+        FP const lhs = number;
+        pol checks{};
+        traits::report_pre_subtraction(checks, lhs, rhs, handler()); // early error detection
+        number = apply(lhs, rhs, std::minus<FP>{});
+        traits::report_post_subtraction(checks, number, handler());
+        return *this;
+    }
+
+    constexpr safe_ref& operator*=(FP rhs) noexcept(nothrow_multiplication)
+    {
+        FP const lhs = number;
+        pol checks{};
+        traits::report_pre_multiplication(checks, lhs, rhs, handler()); // early error detection
+        number = apply(lhs, rhs, std::multiplies<FP>{});
+        traits::report_post_multiplication(checks, number, handler());
+        return *this;
+    }
+
+    constexpr safe_ref& operator/=(FP rhs) noexcept(nothrow_division)
+    {
+        FP const lhs = number;
+        pol checks{};
+        traits::report_pre_division(checks, lhs, rhs, handler()); // early error detection
+        number = apply(lhs, rhs, std::divides<FP>{});
+        traits::report_post_division(checks, number, handler());
+        return *this;
+    }
+
+    // the value of a safe_float checked by the same policies, or of another reference, is the right operand
+    template<template<class T> class CAST>
+    constexpr safe_ref& operator+=(const safe_float<FP, CHECK, ERROR_HANDLING, CAST>& rhs) noexcept(nothrow_addition)
+    {
+        return *this += rhs.get_stored_value();
+    }
+
+    template<template<class T> class CAST>
+    constexpr safe_ref& operator-=(const safe_float<FP, CHECK, ERROR_HANDLING, CAST>& rhs)
+        noexcept(nothrow_subtraction)
+    {
+        return *this -= rhs.get_stored_value();
+    }
+
+    template<template<class T> class CAST>
+    constexpr safe_ref& operator*=(const safe_float<FP, CHECK, ERROR_HANDLING, CAST>& rhs)
+        noexcept(nothrow_multiplication)
+    {
+        return *this *= rhs.get_stored_value();
+    }
+
+    template<template<class T> class CAST>
+    constexpr safe_ref& operator/=(const safe_float<FP, CHECK, ERROR_HANDLING, CAST>& rhs) noexcept(nothrow_division)
+    {
+        return *this /= rhs.get_stored_value();
+    }
+
+    constexpr safe_ref& operator+=(const safe_ref& rhs) noexcept(nothrow_addition) { return *this += rhs.number; }
+    constexpr safe_ref& operator-=(const safe_ref& rhs) noexcept(nothrow_subtraction) { return *this -= rhs.number; }
+    constexpr safe_ref& operator*=(const safe_ref& rhs) noexcept(nothrow_multiplication)
+    {
+        return *this *= rhs.number;
+    }
+    constexpr safe_ref& operator/=(const safe_ref& rhs) noexcept(nothrow_division) { return *this /= rhs.number; }
+};
+
+} // namespace safe_float
+} // namespace boost
+
+#endif // BOOST_SAFE_FLOAT_SAFE_REF_HPP
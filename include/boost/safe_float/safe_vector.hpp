@@ -0,0 +1,480 @@
+#ifndef BOOST_SAFE_FLOAT_SAFE_VECTOR_HPP
+#define BOOST_SAFE_FLOAT_SAFE_VECTOR_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <initializer_list>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include <boost/safe_float.hpp>
+#include <boost/safe_float/detail/bitmap.hpp>
+#include <boost/safe_float/detail/ieee754.hpp>
+#include <boost/safe_float/policy/on_fail_poison.hpp>
+
+namespace boost
+{
+namespace safe_float
+{
+namespace detail
+{
+// true when the report policy marks the failing elements invalid, as on_fail_poison
+template<class ERROR_HANDLING, class = void>
+struct poisons_elements : std::false_type
+{
+};
+
+template<class ERROR_HANDLING>
+struct poisons_elements<ERROR_HANDLING, std::void_t<decltype(ERROR_HANDLING::poisons_elements)>>
+    : std::bool_constant<ERROR_HANDLING::poisons_elements>
+{
+};
+
+} // namespace detail
+
+/**
+ * Contiguous container of FP values checked by the CHECK policies and reported to ERROR_HANDLING.
+ *
+ * The values are stored as primitives, with the storage of ALLOCATOR, and the report policy belongs to the
+ * container. Each operation runs its checks on a new check policy, as safe_float does. Elements are accessed through proxies whose compound assignments are checked as the ones of
+ * safe_float. The compound assignments of a container apply an operation to each element, with the element
+ * of the same index in another container or with a scalar.
+ *
+ * Bulk operations work on blocks of elements: the results of a block are computed by a loop without
+ * branches that the compiler vectorizes, then checked. Checks keeping the operands of an element, or reading
+ * the flags in the value mode, run on a new policy for each element. When a check of the block fails, the block is
+ * computed again one element at a time and each failure is reported as the loop of scalar operations would.
+ *
+ * The container keeps one validity bit per element. With a report policy poisoning the elements, as
+ * on_fail_poison, a failing operation clears the bit of its element in place of reporting it and the bulk
+ * operation continues. Operations between containers propagate the invalid elements of the right operand.
+ *
+ * Writes through the proxies and the bulk operations mark the blocks of validation_block elements they
+ * modify dirty. validate() checks the values of the dirty blocks are neither NaN, infinite nor subnormal,
+ * and keeps the result of each block until it is written again.
+ */
+template<class FP, template<class T> class CHECK = policy::check_all, class ERROR_HANDLING = policy::on_fail_throw,
+         class ALLOCATOR = std::allocator<FP>>
+class safe_vector : private ERROR_HANDLING
+{
+    std::vector<FP, ALLOCATOR> values;
+    detail::bitmap<ALLOCATOR> validity;
+    // a bit per block, set when the block is written after being validated
+    detail::bitmap<ALLOCATOR> dirty;
+    // a bit per block, set when the last validation of the block found invalid values
+    detail::bitmap<ALLOCATOR> failed;
+
+    using pol = CHECK<FP>;
+    using traits = policy::policy_traits<FP, CHECK<FP>>;
+    ERROR_HANDLING& handler() noexcept { return static_cast<ERROR_HANDLING&>(*this); }
+
+    static constexpr bool poisons = detail::poisons_elements<ERROR_HANDLING>::value;
+    static constexpr bool nothrow_validation = poisons || traits::template nothrow_report<ERROR_HANDLING>();
+
+#define BOOST_SAFE_FLOAT_NOTHROW_OPERATION(operation)                                                        \
+    static constexpr bool nothrow_##operation =                                                              \
+        noexcept(traits::report_pre_##operation(std::declval<pol&>(), std::declval<const FP&>(),             \
+                                                std::declval<const FP&>(), std::declval<ERROR_HANDLING&>())) \
+        && noexcept(traits::report_post_##operation(std::declval<pol&>(), std::declval<const FP&>(),         \
+                                                    std::declval<ERROR_HANDLING&>()));
+
+    BOOST_SAFE_FLOAT_NOTHROW_OPERATION(addition)
+    BOOST_SAFE_FLOAT_NOTHROW_OPERATION(subtraction)
+    BOOST_SAFE_FLOAT_NOTHROW_OPERATION(multiplication)
+    BOOST_SAFE_FLOAT_NOTHROW_OPERATION(division)
+
+#undef BOOST_SAFE_FLOAT_NOTHROW_OPERATION
+
+    // Number of elements computed before their checks, the block stays in the first level cache
+    static constexpr std::size_t block_size = 256;
+
+    void check_same_size(const safe_vector& other) const
+    {
+        if (other.size() != size()) throw std::invalid_argument("safe_vector operands have different sizes");
+    }
+
+    static constexpr std::size_t blocks_for(std::size_t n) noexcept
+    {
+        return (n + validation_block_size - 1) / validation_block_size;
+    }
+
+    // Keeps the bitmaps of the size of the values once modify changed it, the elements added are valid and
+    // the blocks whose size changed are dirty. The bitmaps are reserved first, so they grow without throwing
+    // once the values are written
+    template<class MODIFY>
+    void change_size(std::size_t n, MODIFY modify)
+    {
+        validity.reserve(n);
+        dirty.reserve(blocks_for(n));
+        failed.reserve(blocks_for(n));
+        std::size_t const old_size = values.size();
+        modify();
+        validity.resize(values.size(), true);
+        dirty.resize(blocks_for(values.size()), true);
+        failed.resize(blocks_for(values.size()), false);
+        std::size_t const boundary = std::min(old_size, values.size());
+        if (boundary != values.size() + old_size - boundary && boundary % validation_block_size)
+            dirty.set(boundary / validation_block_size);
+    }
+
+    // Reports the invalid values of a block whose validation failed, or poisons them
+    BOOST_SAFE_FLOAT_COLD void report_invalid_values(std::size_t first, std::size_t last) noexcept(nothrow_validation)
+    {
+        for (std::size_t i = first; i != last; ++i)
+        {
+            if (detail::is_normal_or_zero(values[i])) continue;
+            if constexpr (poisons)
+                validity.reset(i);
+            else
+                handler().report_failure(std::string("NaN, infinite or subnormal value in validated safe_vector"));
+        }
+    }
+
+// Checked operation on a single element, the result is written in place and a failure poisons the element
+// when the report policy does.
+// The bulk operation checks each block after computing it: when the checks rely on the flags and keep no state
+// for them, the pre checks of the block clear the flags before the computation and the post checks test the
+// flags raised by the whole block. Other checks reading the flags run before and after the operation of each
+// element, otherwise the pre and post checks of each element are evaluated after the computation of the block.
+#define BOOST_SAFE_FLOAT_VECTOR_OPERATION(operation, OP)                                                         \
+    void checked_##operation(std::size_t index, FP rhs) noexcept(nothrow_##operation)                            \
+    {                                                                                                            \
+        dirty.set(index / validation_block_size);                                                                \
+        FP& target = values[index];                                                                              \
+        FP const lhs = target;                                                                                   \
+        pol checks{};                                                                                            \
+        if constexpr (poisons)                                                                                   \
+        {                                                                                                        \
+            bool valid = traits::pre_##operation##_check(checks, lhs, rhs);                                      \
+            target = detail::ordered_apply<FP, pol>(lhs, rhs, OP{});                                             \
+            valid &= traits::post_##operation##_check(checks, target);                                           \
+            if (BOOST_SAFE_FLOAT_UNLIKELY(!valid)) validity.reset(index);                                        \
+        }                                                                                                        \
+        else                                                                                                     \
+        {                                                                                                        \
+            traits::report_pre_##operation(checks, lhs, rhs, handler()); /* early error detection */             \
+            target = detail::ordered_apply<FP, pol>(lhs, rhs, OP{});                                             \
+            traits::report_post_##operation(checks, target, handler());                                          \
+        }                                                                                                        \
+    }                                                                                                            \
+                                                                                                                 \
+    template<class RHS>                                                                                          \
+    void bulk_##operation(RHS rhs) noexcept(nothrow_##operation)                                                 \
+    {                                                                                                            \
+        FP block[block_size];                                                                                    \
+        dirty.assign(true);                                                                                      \
+        for (std::size_t first = 0; first < values.size(); first += block_size)                                  \
+        {                                                                                                        \
+            std::size_t const count = std::min(block_size, values.size() - first);                               \
+            FP* const lhs = values.data() + first;                                                               \
+            bool valid = true;                                                                                   \
+            if constexpr (detail::batches_fenv<FP, pol>)                                                         \
+            {                                                                                                    \
+                pol checks{};                                                                                    \
+                for (std::size_t i = 0; i != count; ++i)                                                         \
+                    valid &= traits::pre_##operation##_check(checks, lhs[i], rhs(first + i));                    \
+                detail::fenv_memory_barrier();                                                                   \
+                for (std::size_t i = 0; i != count; ++i) block[i] = OP{}(lhs[i], rhs(first + i));                \
+                detail::fenv_memory_barrier();                                                                   \
+                for (std::size_t i = 0; i != count; ++i)                                                         \
+                    valid &= traits::post_##operation##_check(checks, block[i]);                                 \
+            }                                                                                                    \
+            else if constexpr (detail::orders_fenv<FP, pol>)                                                     \
+            {                                                                                                    \
+                for (std::size_t i = 0; i != count; ++i)                                                         \
+                {                                                                                                \
+                    pol checks{};                                                                                \
+                    valid &= traits::pre_##operation##_check(checks, lhs[i], rhs(first + i));                    \
+                    block[i] = detail::ordered_apply<FP, pol>(lhs[i], rhs(first + i), OP{});                     \
+                    valid &= traits::post_##operation##_check(checks, block[i]);                                 \
+                }                                                                                                \
+            }                                                                                                    \
+            else                                                                                                 \
+            {                                                                                                    \
+                for (std::size_t i = 0; i != count; ++i) block[i] = OP{}(lhs[i], rhs(first + i));                \
+                for (std::size_t i = 0; i != count; ++i)                                                         \
+                {                                                                                                \
+                    pol checks{};                                                                                \
+                    valid &= traits::pre_##operation##_check(checks, lhs[i], rhs(first + i));                    \
+                    valid &= traits::post_##operation##_check(checks, block[i]);                                 \
+                }                                                                                                \
+            }                                                                                                    \
+            if (BOOST_SAFE_FLOAT_LIKELY(valid))                                                                  \
+                std::copy_n(block, count, lhs);                                                                  \
+            else                                                                                                 \
+                for (std::size_t i = 0; i != count; ++i) checked_##operation(first + i, rhs(first + i));         \
+        }                                                                                                        \
+    }
+
+    BOOST_SAFE_FLOAT_VECTOR_OPERATION(addition, std::plus<FP>)
+    BOOST_SAFE_FLOAT_VECTOR_OPERATION(subtraction, std::minus<FP>)
+    BOOST_SAFE_FLOAT_VECTOR_OPERATION(multiplication, std::multiplies<FP>)
+    BOOST_SAFE_FLOAT_VECTOR_OPERATION(division, std::divides<FP>)
+
+#undef BOOST_SAFE_FLOAT_VECTOR_OPERATION
+
+public:
+    using value_type = FP;
+    using allocator_type = ALLOCATOR;
+    using size_type = std::size_t;
+    using check_policy = pol;
+    using report_policy = ERROR_HANDLING;
+    using const_iterator = const FP*;
+
+    // Number of elements whose validation is tracked together
+    static constexpr size_type validation_block_size = 4096;
+
+    static_assert(std::is_floating_point<FP>::value,
+                  "First template parameter in safe_vector has to be floating point data type");
+
+    /**
+     * Proxy to an element, checking the compound assignments applied through it with the policies of the
+     * container. Assigning a value writes the element and makes it valid, copies of a proxy refer to the same
+     * element.
+     */
+    class reference
+    {
+        safe_vector* container;
+        size_type index;
+
+        friend class safe_vector;
+        reference(safe_vector& c, size_type i) noexcept : container(&c), index(i) {}
+
+    public:
+        reference(const reference&) noexcept = default;
+
+        reference& operator=(const reference& other) noexcept { return *this = other.get_stored_value(); }
+
+        reference& operator=(FP value) noexcept
+        {
+            container->dirty.set(index / validation_block_size);
+            container->values[index] = value;
+            container->validity.set(index);
+            return *this;
+        }
+
+        FP get_stored_value() const noexcept { return container->values[index]; }
+        operator FP() const noexcept { return container->values[index]; }
+        bool valid() const noexcept { return container->validity.test(index); }
+
+        reference& operator+=(FP rhs) noexcept(nothrow_addition)
+        {
+            container->checked_addition(index, rhs);
+            return *this;
+        }
+
+        reference& operator-=(FP rhs) noexcept(nothrow_subtraction)
+        {
+            container->checked_subtraction(index, rhs);
+            return *this;
+        }
+
+        reference& operator*=(FP rhs) noexcept(nothrow_multiplication)
+        {
+            container->checked_multiplication(index, rhs);
+            return *this;
+        }
+
+        reference& operator/=(FP rhs) noexcept(nothrow_division)
+        {
+            container->checked_division(index, rhs);
+            return *this;
+        }
+    };
+
+    // Constructors, the elements are valid
+    safe_vector() = default;
+
+    explicit safe_vector(const ALLOCATOR& allocator)
+        : values(allocator), validity(allocator), dirty(allocator), failed(allocator)
+    {
+    }
+
+    explicit safe_vector(size_type n, FP value = FP(), const ALLOCATOR& allocator = ALLOCATOR())
+        : values(n, value, allocator), validity(n, true, allocator), dirty(blocks_for(n), true, allocator),
+          failed(blocks_for(n), false, allocator)
+    {
+    }
+
+    safe_vector(std::initializer_list<FP> init, const ALLOCATOR& allocator = ALLOCATOR())
+        : values(init, allocator), validity(values.size(), true, allocator),
+          dirty(blocks_for(values.size()), true, allocator), failed(blocks_for(values.size()), false, allocator)
+    {
+    }
+
+    template<class InputIt>
+    safe_vector(InputIt first, InputIt last, const ALLOCATOR& allocator = ALLOCATOR())
+        : values(first, last, allocator), validity(values.size(), true, allocator),
+          dirty(blocks_for(values.size()), true, allocator), failed(blocks_for(values.size()), false, allocator)
+    {
+    }
+
+    // Capacity
+    size_type size() const noexcept { return values.size(); }
+    bool empty() const noexcept { return values.empty(); }
+    size_type capacity() const noexcept { return values.capacity(); }
+    allocator_type get_allocator() const noexcept { return values.get_allocator(); }
+
+    void reserve(size_type n)
+    {
+        validity.reserve(n);
+        dirty.reserve(blocks_for(n));
+        failed.reserve(blocks_for(n));
+        values.reserve(n);
+    }
+
+    // Modifiers, the values are written as they are and the elements added are valid
+    void resize(size_type n, FP value = FP())
+    {
+        change_size(n, [&] { values.resize(n, value); });
+    }
+
+    void clear() noexcept
+    {
+        change_size(0, [&] { values.clear(); });
+    }
+
+    void push_back(FP value)
+    {
+        change_size(values.size() + 1, [&] { values.push_back(value); });
+    }
+
+    void pop_back() noexcept
+    {
+        change_size(values.size() - 1, [&] { values.pop_back(); });
+    }
+
+    // Element access, writing through data() is neither checked nor marks the blocks dirty
+    reference operator[](size_type i) noexcept { return reference(*this, i); }
+    FP operator[](size_type i) const noexcept { return values[i]; }
+    reference at(size_type i)
+    {
+        values.at(i);
+        return reference(*this, i);
+    }
+    FP at(size_type i) const { return values.at(i); }
+    FP* data() noexcept { return values.data(); }
+    const FP* data() const noexcept { return values.data(); }
+    const_iterator begin() const noexcept { return values.data(); }
+    const_iterator end() const noexcept { return values.data() + values.size(); }
+
+    // Element wise compound assignments, the containers have the same size
+    safe_vector& operator+=(const safe_vector& rhs)
+    {
+        check_same_size(rhs);
+        bulk_addition([&rhs](size_type i) { return rhs.values[i]; });
+        validity.and_with(rhs.validity);
+        return *this;
+    }
+
+    safe_vector& operator-=(const safe_vector& rhs)
+    {
+        check_same_size(rhs);
+        bulk_subtraction([&rhs](size_type i) { return rhs.values[i]; });
+        validity.and_with(rhs.validity);
+        return *this;
+    }
+
+    safe_vector& operator*=(const safe_vector& rhs)
+    {
+        check_same_size(rhs);
+        bulk_multiplication([&rhs](size_type i) { return rhs.values[i]; });
+        validity.and_with(rhs.validity);
+        return *this;
+    }
+
+    safe_vector& operator/=(const safe_vector& rhs)
+    {
+        check_same_size(rhs);
+        bulk_division([&rhs](size_type i) { return rhs.values[i]; });
+        validity.and_with(rhs.validity);
+        return *this;
+    }
+
+    // Compound assignments with a scalar applied to every element
+    safe_vector& operator+=(FP rhs) noexcept(nothrow_addition)
+    {
+        bulk_addition([rhs](size_type) { return rhs; });
+        return *this;
+    }
+
+    safe_vector& operator-=(FP rhs) noexcept(nothrow_subtraction)
+    {
+        bulk_subtraction([rhs](size_type) { return rhs; });
+        return *this;
+    }
+
+    safe_vector& operator*=(FP rhs) noexcept(nothrow_multiplication)
+    {
+        bulk_multiplication([rhs](size_type) { return rhs; });
+        return *this;
+    }
+
+    safe_vector& operator/=(FP rhs) noexcept(nothrow_division)
+    {
+        bulk_division([rhs](size_type) { return rhs; });
+        return *this;
+    }
+
+    // Validity of the elements
+    bool valid(size_type i) const noexcept { return validity.test(i); }
+    size_type invalid_count() const noexcept { return size() - validity.count(); }
+    void reset_validity() noexcept { validity.assign(true); }
+
+    std::vector<size_type> invalid_indexes() const
+    {
+        std::vector<size_type> indexes;
+        indexes.reserve(invalid_count());
+        validity.for_each_cleared([&indexes](size_type i) { indexes.push_back(i); });
+        return indexes;
+    }
+    // (size() + 63) / 64 words, bit i % 64 of word i / 64 is set when element i is valid
+    const std::uint64_t* validity_bitmap() const noexcept { return validity.data(); }
+
+    // Marks dirty the blocks of count elements from first, after writing them through data()
+    void mark_dirty(size_type first, size_type count) noexcept
+    {
+        if (count == 0) return;
+        for (size_type block = first / validation_block_size; block <= (first + count - 1) / validation_block_size;
+             ++block)
+            dirty.set(block);
+    }
+
+    /**
+     * Checks the values of the dirty blocks, reporting the NaN, infinite and subnormal values found, or
+     * marking them invalid when the report policy poisons the elements. The blocks validated earlier and not
+     * written since keep their result. Returns true when no block holds such values.
+     */
+    bool validate() noexcept(nothrow_validation)
+    {
+        dirty.for_each_set([this](size_type block) {
+            size_type const first = block * validation_block_size;
+            size_type const last = std::min(first + validation_block_size, size());
+            size_type invalid = 0;
+            for (size_type i = first; i != last; ++i) invalid += !detail::is_normal_or_zero(values[i]);
+            if (BOOST_SAFE_FLOAT_LIKELY(invalid == 0))
+            {
+                failed.reset(block);
+            }
+            else
+            {
+                failed.set(block);
+                report_invalid_values(first, last);
+            }
+            dirty.reset(block);
+        });
+        return !failed.any();
+    }
+
+    // Number of blocks to check in the next validation
+    size_type dirty_blocks() const noexcept { return dirty.count(); }
+};
+
+} // namespace safe_float
+} // namespace boost
+
+#endif // BOOST_SAFE_FLOAT_SAFE_VECTOR_HPP
@@ -0,0 +1,335 @@
+#ifndef BOOST_SAFE_FLOAT_SERIALIZATION_HPP
+#define BOOST_SAFE_FLOAT_SERIALIZATION_HPP
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <istream>
+#include <limits>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include <boost/safe_float.hpp>
+#include <boost/safe_float/buffer.hpp>
+#include <boost/safe_float/detail/charconv.hpp>
+#include <boost/safe_float/validator.hpp>
+
+namespace boost
+{
+namespace safe_float
+{
+namespace detail
+{
+// The check policies of the library, the identity of a policy is the set of them it holds
+template<class FP>
+using library_checks = policy::compose_check<
+    policy::check_policy, policy::check_addition_overflow, policy::check_subtraction_overflow,
+    policy::check_multiplication_overflow, policy::check_division_overflow, policy::check_addition_underflow,
+    policy::check_subtraction_underflow, policy::check_multiplication_underflow, policy::check_division_underflow,
+    policy::check_addition_inexact, policy::check_subtraction_inexact, policy::check_multiplication_inexact,
+    policy::check_division_inexact, policy::check_addition_invalid_result, policy::check_subtraction_invalid_result,
+    policy::check_multiplication_invalid_result, policy::check_division_invalid_result,
+    policy::check_division_by_zero, policy::check_flush_to_zero, policy::check_subnormal_operand,
+    policy::check_domain_error, policy::check_pole_error, policy::check_range_overflow, policy::check_range_underflow,
+    policy::check_function_inexact>::policy<FP>;
+
+template<class FP, class POLICY, template<class> class... CHECKS>
+constexpr std::uint64_t check_bits() noexcept
+{
+    std::uint64_t bits = 0;
+    int bit = 0;
+    ((bits |= std::uint64_t(policy::is_subset<CHECKS<FP>, POLICY>::value) << bit++), ...);
+    return bits;
+}
+
+/**
+ * Identity of a check policy, one bit for each check policy of the library it holds. A policy holding every
+ * check of another one has the bits of the other one. Policies written by users have no identity, 0.
+ */
+template<class FP, class POLICY>
+constexpr std::uint64_t policy_identity() noexcept
+{
+    if constexpr (!policy::is_subset<POLICY, library_checks<FP>>::value)
+        return 0;
+    else
+        return check_bits<FP, POLICY, policy::check_addition_overflow, policy::check_subtraction_overflow,
+                          policy::check_multiplication_overflow, policy::check_division_overflow,
+                          policy::check_addition_underflow, policy::check_subtraction_underflow,
+                          policy::check_multiplication_underflow, policy::check_division_underflow,
+                          policy::check_addition_inexact, policy::check_subtraction_inexact,
+                          policy::check_multiplication_inexact, policy::check_division_inexact,
+                          policy::check_addition_invalid_result, policy::check_subtraction_invalid_result,
+                          policy::check_multiplication_invalid_result, policy::check_division_invalid_result,
+                          policy::check_division_by_zero, policy::check_flush_to_zero,
+                          policy::check_subnormal_operand, policy::check_domain_error, policy::check_pole_error,
+                          policy::check_range_overflow, policy::check_range_underflow,
+                          policy::check_function_inexact>();
+}
+
+// Header of serialized values, its size keeps the values aligned for every type in aligned buffers. The reserved
+// field is written as zero and ignored when read
+struct serialized_header
+{
+    char magic[8];
+    std::uint32_t value_size;
+    std::uint32_t value_digits;
+    std::uint64_t reserved;
+    std::uint64_t count;
+};
+
+constexpr char serialized_magic[8] = {'S', 'F', 'V', 'A', 'L', 'S', '0', '1'};
+
+constexpr bool little_endian_host()
+{
+#if defined(__BYTE_ORDER__)
+    return __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__;
+#else
+    return true;
+#endif
+}
+
+// Little endian representation of an integer or a value, the bytes are reversed on big endian hosts
+template<class T>
+T little_endian(T value) noexcept
+{
+    if constexpr (!little_endian_host())
+    {
+        unsigned char bytes[sizeof(T)];
+        std::memcpy(bytes, &value, sizeof(T));
+        std::reverse(bytes, bytes + sizeof(T));
+        std::memcpy(&value, bytes, sizeof(T));
+    }
+    return value;
+}
+
+template<class FP>
+serialized_header make_header(std::size_t n) noexcept
+{
+    serialized_header header{};
+    std::memcpy(header.magic, serialized_magic, sizeof(header.magic));
+    header.value_size = little_endian(std::uint32_t(sizeof(FP)));
+    header.value_digits = little_endian(std::uint32_t(std::numeric_limits<FP>::digits));
+    header.count = little_endian(std::uint64_t(n));
+    return header;
+}
+
+// Number of values following a header, throws when it doesn't describe values of FP
+template<class FP>
+std::size_t read_header(const serialized_header& header)
+{
+    if (std::memcmp(header.magic, serialized_magic, sizeof(serialized_magic)) != 0)
+        throw std::invalid_argument("The data doesn't hold serialized values");
+    if (little_endian(header.value_size) != sizeof(FP)
+        || little_endian(header.value_digits) != std::uint32_t(std::numeric_limits<FP>::digits))
+        throw std::invalid_argument("The serialized values are not of the type loaded");
+    return static_cast<std::size_t>(little_endian(header.count));
+}
+
+// Reports the values the policy of SF rejects, as the value checks of the operations classify them
+template<class SF>
+BOOST_SAFE_FLOAT_COLD void report_loaded(const validation_report& report)
+{
+    using checks = conversion_checks<typename SF::value_type, typename SF::check_policy>;
+    typename SF::report_policy handler;
+    auto const report_kind = [&handler](const value_failures& failures, const char* kind) {
+        if (failures.count)
+            handler.report_failure(std::to_string(failures.count) + " " + kind + " values loaded, the first at "
+                                   + std::to_string(failures.first));
+    };
+    if (checks::invalid) report_kind(report.nan, "NaN");
+    if (checks::overflow) report_kind(report.infinite, "infinite");
+    if (checks::underflow) report_kind(report.subnormal, "subnormal");
+}
+
+// Validates loaded values, the policy of the writer doesn't prove them: they may have been stored without a
+// checked operation, or under a report policy that continues after a failure
+template<class SF>
+validation_report validate_loaded(const typename SF::value_type* values, std::size_t n)
+{
+    validation_report const report = validate_values(values, n);
+    if (BOOST_SAFE_FLOAT_UNLIKELY(!report.valid())) report_loaded<SF>(report);
+    return report;
+}
+
+} // namespace detail
+
+/**
+ * Bytes of n serialized values of SF: a header of 32 bytes recording the type of the values and their count,
+ * followed by the values in little endian order.
+ */
+template<class SF>
+constexpr std::size_t serialized_size(std::size_t n) noexcept
+{
+    return sizeof(detail::serialized_header) + n * sizeof(typename SF::value_type);
+}
+
+// Writes n values, throws std::ios_base::failure when the stream fails and throws exceptions
+template<class SF>
+void write_values(std::ostream& out, const SF* values, std::size_t n)
+{
+    static_assert(is_safe_float<SF>::value, "Only safe_float values are serialized");
+    using FP = typename SF::value_type;
+    detail::serialized_header const header = detail::make_header<FP>(n);
+    out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    if constexpr (is_layout_compatible_v<SF> && detail::little_endian_host())
+    {
+        out.write(reinterpret_cast<const char*>(as_raw(values)), static_cast<std::streamsize>(n * sizeof(FP)));
+    }
+    else
+    {
+        for (std::size_t i = 0; i != n; ++i)
+        {
+            FP const value = detail::little_endian(values[i].get_stored_value());
+            out.write(reinterpret_cast<const char*>(&value), sizeof(FP));
+        }
+    }
+}
+
+/**
+ * Values loaded from a buffer of serialized values. The values are viewed in the buffer when SF is layout
+ * compatible with its value, the buffer is aligned for it and the host is little endian, they are copied
+ * otherwise. The buffer has to outlive the view.
+ */
+template<class SF>
+class loaded_values
+{
+    const SF* first = nullptr;
+    std::size_t n = 0;
+    std::vector<SF> copy;
+    validation_report report;
+
+    template<class T>
+    friend loaded_values<T> load_values(const void* data, std::size_t bytes);
+
+public:
+    using value_type = SF;
+    using const_iterator = const SF*;
+
+    loaded_values() = default;
+
+    // the copies view the values of the buffer, or their own copy of the values
+    loaded_values(const loaded_values& other) : first(other.first), n(other.n), copy(other.copy), report(other.report)
+    {
+        if (copied()) first = copy.data();
+    }
+
+    // moving the copy of the values keeps their address
+    loaded_values(loaded_values&& other) noexcept
+        : first(other.first), n(other.n), copy(std::move(other.copy)), report(other.report)
+    {
+        other.first = nullptr;
+        other.n = 0;
+    }
+
+    loaded_values& operator=(const loaded_values& other)
+    {
+        if (this != &other)
+        {
+            copy = other.copy;
+            n = other.n;
+            report = other.report;
+            first = copied() ? copy.data() : other.first;
+        }
+        return *this;
+    }
+
+    loaded_values& operator=(loaded_values&& other) noexcept
+    {
+        if (this != &other)
+        {
+            copy = std::move(other.copy);
+            first = other.first;
+            n = other.n;
+            report = other.report;
+            other.first = nullptr;
+            other.n = 0;
+        }
+        return *this;
+    }
+
+    const SF* data() const noexcept { return first; }
+    std::size_t size() const noexcept { return n; }
+    const SF* begin() const noexcept { return first; }
+    const SF* end() const noexcept { return first + n; }
+    const SF& operator[](std::size_t i) const noexcept { return first[i]; }
+
+    // True when the values were copied out of the buffer
+    bool copied() const noexcept { return !copy.empty(); }
+    // Validation of the values
+    const validation_report& validation() const noexcept { return report; }
+};
+
+/**
+ * Loads serialized values from bytes bytes at data. The values are validated as validate_values does, and the
+ * ones the check policy of SF rejects are reported to its report policy, whatever the policy of the writer.
+ * Throws std::invalid_argument when the bytes don't hold serialized values of the value type of SF.
+ */
+template<class SF>
+loaded_values<SF> load_values(const void* data, std::size_t bytes)
+{
+    static_assert(is_safe_float<SF>::value, "Only safe_float values are serialized");
+    using FP = typename SF::value_type;
+    detail::serialized_header header;
+    if (bytes < sizeof(header)) throw std::invalid_argument("The data doesn't hold serialized values");
+    std::memcpy(&header, data, sizeof(header));
+    std::size_t const n = detail::read_header<FP>(header);
+    if ((bytes - sizeof(header)) / sizeof(FP) < n) throw std::invalid_argument("The serialized values are truncated");
+
+    loaded_values<SF> loaded;
+    loaded.n = n;
+    const unsigned char* const values = static_cast<const unsigned char*>(data) + sizeof(header);
+    if constexpr (is_layout_compatible_v<SF> && detail::little_endian_host())
+    {
+        if (reinterpret_cast<std::uintptr_t>(values) % alignof(FP) == 0)
+        {
+            loaded.first = as_safe<SF>(reinterpret_cast<const FP*>(values), n);
+            loaded.report = detail::validate_loaded<SF>(reinterpret_cast<const FP*>(values), n);
+            return loaded;
+        }
+    }
+    std::vector<FP> read(n);
+    std::memcpy(read.data(), values, n * sizeof(FP));
+    for (FP& value : read) value = detail::little_endian(value);
+    loaded.report = detail::validate_loaded<SF>(read.data(), n);
+    loaded.copy.reserve(n);
+    for (FP value : read) loaded.copy.emplace_back(value);
+    loaded.first = loaded.copy.data();
+    return loaded;
+}
+
+/**
+ * Reads serialized values from a stream and validates them as load_values does. Throws std::invalid_argument
+ * when the stream doesn't hold serialized values of the value type of SF.
+ */
+template<class SF>
+std::vector<SF> read_values(std::istream& in)
+{
+    static_assert(is_safe_float<SF>::value, "Only safe_float values are serialized");
+    using FP = typename SF::value_type;
+    detail::serialized_header header;
+    if (!in.read(reinterpret_cast<char*>(&header), sizeof(header)))
+        throw std::invalid_argument("The stream doesn't hold serialized values");
+    std::size_t const n = detail::read_header<FP>(header);
+
+    // read by blocks, a corrupted count doesn't allocate more than the stream holds
+    std::vector<FP> read;
+    while (read.size() != n)
+    {
+        std::size_t const first = read.size();
+        read.resize(first + std::min<std::size_t>(n - first, std::size_t(1) << 20));
+        if (!in.read(reinterpret_cast<char*>(read.data() + first),
+                     static_cast<std::streamsize>((read.size() - first) * sizeof(FP))))
+            throw std::invalid_argument("The serialized values are truncated");
+    }
+    for (FP& value : read) value = detail::little_endian(value);
+    detail::validate_loaded<SF>(read.data(), n);
+    return std::vector<SF>(read.begin(), read.end());
+}
+
+} // namespace safe_float
+} // namespace boost
+
+#endif // BOOST_SAFE_FLOAT_SERIALIZATION_HPP
@@ -0,0 +1,297 @@
+#ifndef BOOST_SAFE_FLOAT_VALIDATION_INDEX_HPP
+#define BOOST_SAFE_FLOAT_VALIDATION_INDEX_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <memory>
+#include <string>
+#include <system_error>
+#include <vector>
+
+#include <boost/safe_float/validator.hpp>
+
+namespace boost
+{
+namespace safe_float
+{
+namespace detail
+{
+// Bytes of the data file described by an entry of the index
+constexpr std::size_t index_block_bytes = std::size_t(1) << 20;
+
+// Summary of a block of the data file, firsts are offsets from the beginning of the block
+struct index_entry
+{
+    std::uint64_t checksum;
+    // range of the exponents of the normal values, min_exponent > max_exponent without normal values
+    std::int32_t min_exponent;
+    std::int32_t max_exponent;
+    std::uint32_t nan_count;
+    std::uint32_t infinite_count;
+    std::uint32_t subnormal_count;
+    std::uint32_t first_nan;
+    std::uint32_t first_infinite;
+    std::uint32_t first_subnormal;
+};
+
+struct index_header
+{
+    char magic[8];
+    std::uint32_t value_size;
+    std::uint32_t value_digits;
+    std::uint64_t block_bytes;
+    std::uint64_t file_size;
+    std::int64_t file_time;
+    std::uint64_t blocks;
+};
+
+constexpr char index_magic[8] = {'S', 'F', 'V', 'I', 'D', 'X', '0', '1'};
+
+inline std::uint64_t rotate_left(std::uint64_t word, int bits) noexcept
+{
+    return (word << bits) | (word >> (64 - bits));
+}
+
+// 64 bits checksum of a block, four independent lanes of multiply and rotate rounds keep the units busy
+inline std::uint64_t block_checksum(const unsigned char* data, std::size_t bytes) noexcept
+{
+    constexpr std::uint64_t prime1 = 0x9E3779B185EBCA87ull;
+    constexpr std::uint64_t prime2 = 0xC2B2AE3D27D4EB4Full;
+    std::uint64_t lanes[4] = {prime1 + prime2, prime2, 0, 0 - prime1};
+    std::size_t i = 0;
+    for (; i + 32 <= bytes; i += 32)
+    {
+        for (int lane = 0; lane != 4; ++lane)
+        {
+            std::uint64_t word;
+            std::memcpy(&word, data + i + 8 * lane, sizeof(word));
+            lanes[lane] = rotate_left(lanes[lane] + word * prime2, 31) * prime1;
+        }
+    }
+    std::uint64_t hash = rotate_left(lanes[0], 1) + rotate_left(lanes[1], 7) + rotate_left(lanes[2], 12)
+                         + rotate_left(lanes[3], 18) + bytes;
+    for (; i != bytes; ++i) hash = (hash ^ data[i]) * prime1;
+    hash ^= hash >> 33;
+    hash *= prime2;
+    hash ^= hash >> 29;
+    return hash;
+}
+
+template<class FP>
+index_entry summarize_block(const FP* data, std::size_t n)
+{
+    index_entry entry{};
+    entry.checksum = block_checksum(reinterpret_cast<const unsigned char*>(data), n * sizeof(FP));
+
+    validation_report report;
+    scan_values(data, 0, n, value_range<FP>(), report);
+    entry.nan_count = static_cast<std::uint32_t>(report.nan.count);
+    entry.infinite_count = static_cast<std::uint32_t>(report.infinite.count);
+    entry.subnormal_count = static_cast<std::uint32_t>(report.subnormal.count);
+    entry.first_nan = static_cast<std::uint32_t>(report.nan.first);
+    entry.first_infinite = static_cast<std::uint32_t>(report.infinite.first);
+    entry.first_subnormal = static_cast<std::uint32_t>(report.subnormal.first);
+
+    std::int32_t min_exponent = std::numeric_limits<std::int32_t>::max();
+    std::int32_t max_exponent = std::numeric_limits<std::int32_t>::min();
+    for (std::size_t i = 0; i != n; ++i)
+    {
+        std::int32_t exponent;
+        if constexpr (ieee754_format<FP>::known)
+        {
+            // the fields of zero and subnormal values are 0, the ones of infinite and NaN values all ones
+            unsigned const field = exponent_field(data[i]);
+            if (field == 0 || field == 2u * std::numeric_limits<FP>::max_exponent - 1) continue;
+            exponent = static_cast<std::int32_t>(field) - (std::numeric_limits<FP>::max_exponent - 1);
+        }
+        else
+        {
+            if (!std::isnormal(data[i])) continue;
+            exponent = std::ilogb(data[i]);
+        }
+        min_exponent = std::min(min_exponent, exponent);
+        max_exponent = std::max(max_exponent, exponent);
+    }
+    entry.min_exponent = min_exponent;
+    entry.max_exponent = max_exponent;
+    return entry;
+}
+
+// true when every normal value of the block is in range, known from the largest exponent
+template<class FP>
+bool block_in_range(const index_entry& entry, const value_range<FP>& range)
+{
+    if (entry.min_exponent > entry.max_exponent) return true;
+    if (entry.max_exponent >= std::numeric_limits<FP>::max_exponent - 1)
+        return range.lowest == std::numeric_limits<FP>::lowest() && range.highest == std::numeric_limits<FP>::max();
+    FP const bound = std::ldexp(FP(1), entry.max_exponent + 1);
+    return range.lowest <= -bound && range.highest >= bound;
+}
+
+inline void add_failures(value_failures& failures, std::uint32_t count, std::size_t first) noexcept
+{
+    if (count == 0) return;
+    if (failures.count == 0) failures.first = first;
+    failures.count += count;
+}
+
+inline std::int64_t file_time(const std::string& path)
+{
+    return static_cast<std::int64_t>(std::filesystem::last_write_time(path).time_since_epoch().count());
+}
+
+// Entries of the index at index_path when it describes files of FP values, empty otherwise. The count of entries
+// must be the one of the file size in the header and fill the rest of the index, it is not trusted otherwise
+template<class FP>
+bool read_index(const std::string& index_path, index_header& header, std::vector<index_entry>& entries)
+{
+    std::ifstream file(index_path, std::ios::binary);
+    if (!file.read(reinterpret_cast<char*>(&header), sizeof(header))) return false;
+    if (std::memcmp(header.magic, index_magic, sizeof(index_magic)) != 0 || header.value_size != sizeof(FP)
+        || header.value_digits != std::numeric_limits<FP>::digits || header.block_bytes != index_block_bytes)
+        return false;
+    std::uint64_t const block_values = index_block_bytes / sizeof(FP);
+    std::uint64_t const values = header.file_size / sizeof(FP);
+    if (header.blocks != values / block_values + (values % block_values != 0)) return false;
+    std::error_code error;
+    std::uint64_t const index_size = std::filesystem::file_size(index_path, error);
+    if (error || (index_size - sizeof(header)) / sizeof(index_entry) != header.blocks
+        || (index_size - sizeof(header)) % sizeof(index_entry) != 0)
+        return false;
+    entries.resize(static_cast<std::size_t>(header.blocks));
+    return static_cast<bool>(
+        file.read(reinterpret_cast<char*>(entries.data()), entries.size() * sizeof(index_entry)));
+}
+
+// Writes the index next to its final path and renames it, readers never see a partial index
+inline void write_index(const std::string& index_path, const index_header& header,
+                        const std::vector<index_entry>& entries)
+{
+    std::string const written = index_path + ".tmp";
+    {
+        std::ofstream file(written, std::ios::binary | std::ios::trunc);
+        file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        file.write(reinterpret_cast<const char*>(entries.data()), entries.size() * sizeof(index_entry));
+        if (!file.flush()) throw std::system_error(errno, std::generic_category(), written);
+    }
+    std::filesystem::rename(written, index_path);
+}
+
+} // namespace detail
+
+/**
+ * Validates a file as validate_file does, keeping a summary of each block of the file in a sidecar index.
+ *
+ * The index stores a checksum of each block of 1 MiB, the range of the exponents of its normal values and
+ * the number of NaN, infinite and subnormal values. When the size and modification time of the file match
+ * the index, the report is built from the index without reading the file. Otherwise the checksums of the
+ * blocks are computed and only the blocks whose checksum changed are scanned, then the index is written
+ * again. Blocks whose exponents may exceed a given range are scanned for the values out of range.
+ */
+template<class FP>
+validation_report validate_file_indexed(const std::string& path, const std::string& index_path,
+                                        const value_range<FP>& range = value_range<FP>(), unsigned threads = 1)
+{
+    static_assert(std::is_floating_point<FP>::value, "Only floating point values are validated");
+    constexpr std::size_t block_values = detail::index_block_bytes / sizeof(FP);
+
+    detail::index_header header{};
+    std::vector<detail::index_entry> entries;
+    bool const indexed = detail::read_index<FP>(index_path, header, entries);
+    std::uint64_t const file_size = std::filesystem::file_size(path);
+    std::int64_t const file_time = detail::file_time(path);
+    if (file_size % sizeof(FP) != 0) throw std::invalid_argument(path + " doesn't hold a whole number of values");
+    std::size_t const n = static_cast<std::size_t>(file_size / sizeof(FP));
+    std::size_t const blocks = (n + block_values - 1) / block_values;
+    bool const trusted = indexed && header.file_size == file_size && header.file_time == file_time;
+
+    validation_report report;
+    std::vector<std::size_t> range_checked;
+    std::unique_ptr<detail::mapped_file> file;
+    const FP* data = nullptr;
+    auto map = [&] {
+        if (!file)
+        {
+            file = std::make_unique<detail::mapped_file>(path);
+            data = static_cast<const FP*>(file->data());
+        }
+    };
+
+    if (!trusted)
+    {
+        map();
+        std::vector<detail::index_entry> previous = std::move(entries);
+        entries.assign(blocks, detail::index_entry{});
+        std::vector<std::size_t> scanned(std::max<std::size_t>(1, std::min<std::size_t>(threads, blocks)));
+        task_group group;
+        for (std::size_t chunk = 0; chunk != scanned.size(); ++chunk)
+        {
+            group.run([&, chunk] {
+                for (std::size_t b = blocks * chunk / scanned.size(); b != blocks * (chunk + 1) / scanned.size(); ++b)
+                {
+                    std::size_t const count = std::min(block_values, n - b * block_values);
+                    const FP* const block = data + b * block_values;
+                    std::uint64_t const checksum =
+                        detail::block_checksum(reinterpret_cast<const unsigned char*>(block), count * sizeof(FP));
+                    // the checksum covers the length, a partial last block that grew doesn't match
+                    if (b < previous.size() && previous[b].checksum == checksum)
+                    {
+                        entries[b] = previous[b];
+                    }
+                    else
+                    {
+                        entries[b] = detail::summarize_block(block, count);
+                        scanned[chunk] += count;
+                    }
+                }
+            });
+        }
+        group.wait();
+        for (std::size_t chunk_scanned : scanned) report.scanned += chunk_scanned;
+
+        header = detail::index_header{};
+        std::memcpy(header.magic, detail::index_magic, sizeof(header.magic));
+        header.value_size = sizeof(FP);
+        header.value_digits = std::numeric_limits<FP>::digits;
+        header.block_bytes = detail::index_block_bytes;
+        header.file_size = file_size;
+        header.file_time = file_time;
+        header.blocks = blocks;
+        detail::write_index(index_path, header, entries);
+    }
+
+    report.values = n;
+    for (std::size_t b = 0; b != entries.size(); ++b)
+    {
+        const detail::index_entry& entry = entries[b];
+        std::size_t const first = b * block_values;
+        detail::add_failures(report.nan, entry.nan_count, first + entry.first_nan);
+        detail::add_failures(report.infinite, entry.infinite_count, first + entry.first_infinite);
+        detail::add_failures(report.subnormal, entry.subnormal_count, first + entry.first_subnormal);
+        if (!detail::block_in_range(entry, range)) range_checked.push_back(b);
+    }
+
+    // values out of range, from the blocks whose exponents don't tell
+    if (!range_checked.empty()) map();
+    for (std::size_t b : range_checked)
+    {
+        std::size_t const first = b * block_values;
+        std::size_t const count = std::min(block_values, n - first);
+        validation_report block;
+        detail::scan_values(data + first, 0, count, range, block);
+        if (block.out_of_range.count) block.out_of_range.first += first;
+        report.out_of_range.merge(block.out_of_range);
+        report.scanned += count;
+    }
+    return report;
+}
+
+} // namespace safe_float
+} // namespace boost
+
+#endif // BOOST_SAFE_FLOAT_VALIDATION_INDEX_HPP
@@ -0,0 +1,323 @@
+#ifndef BOOST_SAFE_FLOAT_VALIDATOR_HPP
+#define BOOST_SAFE_FLOAT_VALIDATOR_HPP
+
+#include <algorithm>
+#include <cerrno>
+#include <cstddef>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <type_traits>
+#include <vector>
+
+#if __has_include(<version>)
+#include <version>
+#endif
+#if defined(__cpp_lib_span)
+#include <span>
+#endif
+
+#if defined(__unix__) || defined(__APPLE__)
+#define BOOST_SAFE_FLOAT_HAS_MMAP
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#else
+#include <fstream>
+#endif
+
+#include <boost/safe_float/detail/config.hpp>
+#include <boost/safe_float/detail/ieee754.hpp>
+#include <boost/safe_float/parallel.hpp>
+
+namespace boost
+{
+namespace safe_float
+{
+// Number of values of a kind of failure and index of the first one, npos when there is none
+struct value_failures
+{
+    static constexpr std::size_t npos = std::size_t(-1);
+
+    std::size_t count = 0;
+    std::size_t first = npos;
+
+    void add(std::size_t index) noexcept
+    {
+        if (count++ == 0) first = index;
+    }
+
+    void merge(const value_failures& other) noexcept
+    {
+        count += other.count;
+        first = std::min(first, other.first);
+    }
+};
+
+/**
+ * Values found by a validation, classified as the value checks of the policies do: NaN values are invalid
+ * results, infinite values overflows and subnormal values underflows. Finite values outside the range
+ * given to the validation are out of range.
+ */
+struct validation_report
+{
+    std::size_t values = 0;
+    // values read to build the report, fewer than values when an index was trusted
+    std::size_t scanned = 0;
+    value_failures nan;
+    value_failures infinite;
+    value_failures subnormal;
+    value_failures out_of_range;
+
+    std::size_t failures() const noexcept { return nan.count + infinite.count + subnormal.count + out_of_range.count; }
+    bool valid() const noexcept { return failures() == 0; }
+
+    void merge(const validation_report& other) noexcept
+    {
+        values += other.values;
+        scanned += other.scanned;
+        nan.merge(other.nan);
+        infinite.merge(other.infinite);
+        subnormal.merge(other.subnormal);
+        out_of_range.merge(other.out_of_range);
+    }
+};
+
+// Finite values accepted by a validation, the whole range of FP by default
+template<class FP>
+struct value_range
+{
+    FP lowest = std::numeric_limits<FP>::lowest();
+    FP highest = std::numeric_limits<FP>::max();
+};
+
+namespace detail
+{
+// Number of values tested together before classifying them, a block stays in the first level cache
+constexpr std::size_t validation_block = 4096;
+
+template<class FP>
+BOOST_SAFE_FLOAT_COLD void classify_values(const FP* data, std::size_t first, std::size_t last,
+                                           const value_range<FP>& range, validation_report& report) noexcept
+{
+    for (std::size_t i = first; i != last; ++i)
+    {
+        FP const value = data[i];
+        if (is_nan(value))
+            report.nan.add(i);
+        else if (is_inf(value))
+            report.infinite.add(i);
+        else if (is_subnormal(value))
+            report.subnormal.add(i);
+        else if (value < range.lowest || value > range.highest)
+            report.out_of_range.add(i);
+    }
+}
+
+// Scans [first, last) with a loop without branches the compiler vectorizes, only the blocks holding failures
+// are classified
+template<class FP>
+void scan_values(const FP* data, std::size_t first, std::size_t last, const value_range<FP>& range,
+                 validation_report& report) noexcept
+{
+    for (std::size_t block = first; block < last; block += validation_block)
+    {
+        std::size_t const end = std::min(block + validation_block, last);
+        // counted in FP, the vector units compare and add values of the same width without conversions
+        FP rejected = 0;
+        for (std::size_t i = block; i != end; ++i)
+        {
+            FP const value = data[i];
+            rejected += is_normal_or_zero(value) & (value >= range.lowest) & (value <= range.highest) ? FP(0) : FP(1);
+        }
+        if (BOOST_SAFE_FLOAT_UNLIKELY(rejected != 0)) classify_values(data, block, end, range, report);
+    }
+    report.values += last - first;
+    report.scanned += last - first;
+}
+
+// Smallest and largest values of [first, last) other than NaN, NaN compares false and is skipped. Without other
+// values lowest > highest. Each lane keeps its own bounds, the compiler doesn't reorder the comparisons of a single
+// reduction and the lanes run in parallel instead of waiting for each other.
+template<class FP>
+void value_bounds(const FP* data, std::size_t first, std::size_t last, FP& lowest, FP& highest) noexcept
+{
+    constexpr std::size_t lanes = 8;
+    FP low[lanes];
+    FP high[lanes];
+    for (std::size_t lane = 0; lane != lanes; ++lane)
+    {
+        low[lane] = std::numeric_limits<FP>::infinity();
+        high[lane] = -std::numeric_limits<FP>::infinity();
+    }
+    std::size_t const whole = first + (last - first) / lanes * lanes;
+    std::size_t i = first;
+    for (; i != whole; i += lanes)
+    {
+        for (std::size_t lane = 0; lane != lanes; ++lane)
+        {
+            FP const value = data[i + lane];
+            low[lane] = value < low[lane] ? value : low[lane];
+            high[lane] = value > high[lane] ? value : high[lane];
+        }
+    }
+    for (; i != last; ++i)
+    {
+        low[0] = data[i] < low[0] ? data[i] : low[0];
+        high[0] = data[i] > high[0] ? data[i] : high[0];
+    }
+    lowest = *std::min_element(low, low + lanes);
+    highest = *std::max_element(high, high + lanes);
+}
+
+#if defined(BOOST_SAFE_FLOAT_HAS_MMAP)
+// Read only mapping of a whole file, advised to be read sequentially
+class mapped_file
+{
+    void* address = nullptr;
+    std::size_t bytes = 0;
+
+public:
+    explicit mapped_file(const std::string& path)
+    {
+        int const fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0) throw std::system_error(errno, std::generic_category(), path);
+        struct stat status;
+        if (::fstat(fd, &status) != 0)
+        {
+            int const error = errno;
+            ::close(fd);
+            throw std::system_error(error, std::generic_category(), path);
+        }
+        bytes = static_cast<std::size_t>(status.st_size);
+        if (bytes != 0)
+        {
+            address = ::mmap(nullptr, bytes, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (address == MAP_FAILED)
+            {
+                int const error = errno;
+                ::close(fd);
+                throw std::system_error(error, std::generic_category(), path);
+            }
+            ::madvise(address, bytes, MADV_SEQUENTIAL);
+        }
+        ::close(fd);
+    }
+
+    ~mapped_file()
+    {
+        if (bytes != 0) ::munmap(address, bytes);
+    }
+
+    mapped_file(const mapped_file&) = delete;
+    mapped_file& operator=(const mapped_file&) = delete;
+
+    const void* data() const noexcept { return address; }
+    std::size_t size() const noexcept { return bytes; }
+};
+#else
+// Without mappings the whole file is read in memory
+class mapped_file
+{
+    std::vector<std::max_align_t> buffer;
+    std::size_t bytes = 0;
+
+public:
+    explicit mapped_file(const std::string& path)
+    {
+        std::ifstream file(path, std::ios::binary | std::ios::ate);
+        if (!file) throw std::system_error(errno, std::generic_category(), path);
+        bytes = static_cast<std::size_t>(file.tellg());
+        buffer.resize((bytes + sizeof(std::max_align_t) - 1) / sizeof(std::max_align_t));
+        file.seekg(0);
+        if (!file.read(reinterpret_cast<char*>(buffer.data()), static_cast<std::streamsize>(bytes)))
+            throw std::system_error(errno, std::generic_category(), path);
+    }
+
+    const void* data() const noexcept { return buffer.data(); }
+    std::size_t size() const noexcept { return bytes; }
+};
+#endif
+
+} // namespace detail
+
+/**
+ * Validates n values, splitting them in contiguous chunks scanned by threads tasks. The indexes in the
+ * report are relative to data.
+ */
+template<class FP>
+validation_report validate_values(const FP* data, std::size_t n, const value_range<FP>& range = value_range<FP>(),
+                                  unsigned threads = 1)
+{
+    static_assert(std::is_floating_point<FP>::value, "Only floating point values are validated");
+    std::size_t const chunks = std::max<std::size_t>(1, std::min<std::size_t>(threads, n / detail::validation_block));
+    validation_report report;
+    if (chunks == 1)
+    {
+        detail::scan_values(data, 0, n, range, report);
+        return report;
+    }
+
+    std::vector<validation_report> partial(chunks);
+    task_group group;
+    for (std::size_t chunk = 0; chunk != chunks; ++chunk)
+    {
+        group.run([data, n, chunk, chunks, &range, &partial] {
+            detail::scan_values(data, n * chunk / chunks, n * (chunk + 1) / chunks, range, partial[chunk]);
+        });
+    }
+    group.wait();
+    for (const validation_report& chunk_report : partial) report.merge(chunk_report);
+    return report;
+}
+
+#if defined(__cpp_lib_span)
+template<class FP, std::size_t EXTENT>
+validation_report validate_values(std::span<const FP, EXTENT> values, const value_range<FP>& range = value_range<FP>(),
+                                  unsigned threads = 1)
+{
+    return validate_values(values.data(), values.size(), range, threads);
+}
+#endif
+
+/**
+ * Validates a file holding FP values in the representation of the target, mapped in memory where the
+ * system provides it and read by blocks otherwise. The indexes in the report count values from the
+ * beginning of the file. Throws std::system_error when the file can't be read, and std::invalid_argument
+ * when its size is not a multiple of the size of FP.
+ */
+template<class FP>
+validation_report validate_file(const std::string& path, const value_range<FP>& range = value_range<FP>(),
+                                unsigned threads = 1)
+{
+#if defined(BOOST_SAFE_FLOAT_HAS_MMAP)
+    detail::mapped_file const file(path);
+    if (file.size() % sizeof(FP) != 0) throw std::invalid_argument(path + " doesn't hold a whole number of values");
+    return validate_values(static_cast<const FP*>(file.data()), file.size() / sizeof(FP), range, threads);
+#else
+    std::ifstream file(path, std::ios::binary);
+    if (!file) throw std::system_error(errno, std::generic_category(), path);
+    std::vector<FP> values(std::size_t(1) << 20);
+    validation_report report;
+    for (;;)
+    {
+        file.read(reinterpret_cast<char*>(values.data()), values.size() * sizeof(FP));
+        std::size_t const bytes = static_cast<std::size_t>(file.gcount());
+        if (bytes % sizeof(FP) != 0) throw std::invalid_argument(path + " doesn't hold a whole number of values");
+        validation_report block = validate_values(values.data(), bytes / sizeof(FP), range, threads);
+        for (value_failures* failures : {&block.nan, &block.infinite, &block.subnormal, &block.out_of_range})
+            if (failures->count) failures->first += report.values;
+        report.merge(block);
+        if (bytes < values.size() * sizeof(FP)) break;
+    }
+    if (file.bad()) throw std::system_error(errno, std::generic_category(), path);
+    return report;
+#endif
+}
+
+} // namespace safe_float
+} // namespace boost
+
+#endif // BOOST_SAFE_FLOAT_VALIDATOR_HPP
@@ -0,0 +1,8 @@
+#include <boost/safe_float.hpp>
+
+// A check failing during constant evaluation is a compile error
+int main() {
+    using boost::safe_float::safe_float;
+    constexpr safe_float<double> inexact = safe_float<double>(1e16) + safe_float<double>(1.0);
+    return inexact > safe_float<double>(0.0);
+}
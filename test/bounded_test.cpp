@@ -0,0 +1,167 @@
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <boost/mpl/list.hpp>
+
+#include <functional>
+#include <limits>
+#include <ratio>
+#include <type_traits>
+
+#include <boost/safe_float/bounded.hpp>
+#include <boost/safe_float/policy/on_fail_count.hpp>
+
+//types to be tested
+using test_types=boost::mpl::list<
+    float, double, long double
+>;
+
+using namespace boost::safe_float;
+
+using zero = std::ratio<0>;
+using one = std::ratio<1>;
+using two = std::ratio<2>;
+
+// bound out of the range of std::ratio
+template<class FPT>
+struct largest {
+    static constexpr long double value = std::numeric_limits<FPT>::max();
+};
+
+// decimal bound close to the largest values, not a value of FPT
+template<class FPT>
+struct largest_decimal {
+    static constexpr long double value = std::is_same<FPT, float>::value ? 1e38L : 1e300L;
+};
+
+template<class CHECK, class POLICY>
+constexpr bool runs = policy::is_subset<CHECK, POLICY>::value;
+
+/**
+  This test suite checks the operations of bounded values compute the bounds of their results and drop the
+  checks the bounds prove useless, and keep the others.
+  */
+BOOST_AUTO_TEST_SUITE( bounded_test_suite )
+
+BOOST_AUTO_TEST_CASE_TEMPLATE( bounded_checks_are_dropped, FPT, test_types){
+    using probability = bounded_safe_float<FPT, zero, one, policy::check_all>;
+    using multiplication = typename probability::template operation_checks<std::multiplies<FPT>>;
+    static_assert(!runs<policy::check_multiplication_overflow<FPT>, multiplication>, "");
+    static_assert(!runs<policy::check_multiplication_invalid_result<FPT>, multiplication>, "");
+    static_assert(runs<policy::check_multiplication_underflow<FPT>, multiplication>, "");
+    static_assert(runs<policy::check_multiplication_inexact<FPT>, multiplication>, "");
+
+    // a divisor that may be zero keeps the checks of the division
+    using division = typename probability::template operation_checks<std::divides<FPT>>;
+    static_assert(runs<policy::check_division_by_zero<FPT>, division>, "");
+    static_assert(runs<policy::check_division_overflow<FPT>, division>, "");
+    static_assert(runs<policy::check_division_invalid_result<FPT>, division>, "");
+
+    // the values in [1, 2] neither overflow nor underflow, and are not zero
+    using range = bounded_safe_float<FPT, one, two, policy::check_all>;
+    using quotient = typename range::template operation_checks<std::divides<FPT>>;
+    static_assert(!runs<policy::check_division_by_zero<FPT>, quotient>, "");
+    static_assert(!runs<policy::check_division_underflow<FPT>, quotient>, "");
+    static_assert(runs<policy::check_division_inexact<FPT>, quotient>, "");
+
+    using unchecked = bounded_safe_float<FPT, one, two, policy::check_bothflow>;
+    static_assert(std::is_same<typename unchecked::template operation_checks<std::plus<FPT>>,
+                               policy::composed_check<FPT>>::value, "");
+    unchecked const a(FPT(1.5));
+    static_assert(noexcept(a * a + a / a), "");
+    static_assert(!noexcept(probability(FPT(0.5)) * probability(FPT(0.5))), "");
+
+    // the bounds don't hold when the failures don't stop the operations
+    using counted = bounded_safe_float<FPT, zero, one, policy::check_all, policy::on_fail_count>;
+    using counted_multiplication = typename counted::template operation_checks<std::multiplies<FPT>>;
+    static_assert(runs<policy::check_multiplication_overflow<FPT>, counted_multiplication>, "");
+    static_assert(runs<policy::check_multiplication_invalid_result<FPT>, counted_multiplication>, "");
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE( bounded_results_are_bounded, FPT, test_types){
+    using range = bounded_safe_float<FPT, one, two>;
+    range const a(FPT(1.5));
+    range const b(FPT(2));
+    auto const sum = a + b;
+    BOOST_CHECK_EQUAL(sum.get_stored_value(), FPT(3.5));
+    BOOST_CHECK(decltype(sum)::lowest_bound <= 2 && decltype(sum)::lowest_bound > 1.99);
+    BOOST_CHECK(decltype(sum)::highest_bound >= 4 && decltype(sum)::highest_bound < 4.01);
+    auto const difference = a - b;
+    BOOST_CHECK_EQUAL(difference.get_stored_value(), FPT(-0.5));
+    BOOST_CHECK(decltype(difference)::lowest_bound <= -1 && decltype(difference)::highest_bound >= 1);
+    auto const product = (a - b) * b;
+    BOOST_CHECK_EQUAL(product.get_stored_value(), FPT(-1));
+    BOOST_CHECK(decltype(product)::lowest_bound <= -2 && decltype(product)::highest_bound >= 2);
+    auto const quotient = b / a / b;
+    BOOST_CHECK(decltype(quotient)::lowest_bound <= 0.25 && decltype(quotient)::highest_bound >= 1);
+
+    // the bounds of a product of a value that may be large are not finite
+    using large = bounded_safe_float<FPT, zero, largest<FPT>>;
+    static_assert(decltype(large(FPT(1)) * a)::highest_bound == std::numeric_limits<long double>::infinity(), "");
+    BOOST_CHECK_THROW(large(std::numeric_limits<FPT>::max()) * b, std::exception);
+
+    // the bounds are rounded outward to values of FPT, the bounds hold the values of FPT nearest to them
+    using tenth = bounded_safe_float<FPT, zero, std::ratio<1, 10>>;
+    BOOST_CHECK_EQUAL(tenth(FPT(0.1L)).get_stored_value(), FPT(0.1L));
+    BOOST_CHECK(tenth::highest_bound >= 0.1L && tenth::highest_bound == static_cast<long double>(FPT(0.1L)));
+    using negative_tenth = bounded_safe_float<FPT, std::ratio<-1, 10>, zero>;
+    BOOST_CHECK_EQUAL(negative_tenth(-FPT(0.1L)).get_stored_value(), -FPT(0.1L));
+    using third = bounded_safe_float<FPT, std::ratio<1, 3>, std::ratio<1, 3>>;
+    BOOST_CHECK(third::lowest_bound <= 1.0L / 3 && third::highest_bound >= 1.0L / 3);
+    BOOST_CHECK(third::lowest_bound == static_cast<FPT>(third::lowest_bound));
+    BOOST_CHECK(third::highest_bound == static_cast<FPT>(third::highest_bound));
+    BOOST_CHECK_NO_THROW(third(FPT(1.0L / 3)));
+    using huge = bounded_safe_float<FPT, zero, largest_decimal<FPT>>;
+    BOOST_CHECK_NO_THROW(huge(FPT(largest_decimal<FPT>::value)));
+
+    // narrower bounds convert implicitly, wider ones are checked
+    bounded_safe_float<FPT, zero, std::ratio<10>> wide = a;
+    BOOST_CHECK_EQUAL(wide.get_stored_value(), FPT(1.5));
+    BOOST_CHECK_EQUAL(range(wide).get_stored_value(), FPT(1.5));
+    wide = bounded_safe_float<FPT, zero, std::ratio<10>>(FPT(8));
+    BOOST_CHECK_THROW(range{wide}, std::exception);
+    BOOST_CHECK_EQUAL(a.to_safe_float().get_stored_value(), FPT(1.5));
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE( bounded_failures_are_reported, FPT, test_types){
+    using probability = bounded_safe_float<FPT, zero, one, policy::check_all, policy::on_fail_count>;
+    policy::on_fail_count::reset();
+    probability p(FPT(0.5));
+    probability(FPT(1.5));
+    probability(-std::numeric_limits<FPT>::quiet_NaN());
+    BOOST_CHECK_EQUAL(policy::on_fail_count::count(), 2u);
+
+    // the sum may be out of the bounds of p, the product may not
+    policy::on_fail_count::reset();
+    p *= p;
+    BOOST_CHECK_EQUAL(p.get_stored_value(), FPT(0.25));
+    BOOST_CHECK_EQUAL(policy::on_fail_count::count(), 0u);
+    p += probability(FPT(1));
+    BOOST_CHECK_EQUAL(policy::on_fail_count::count(), 1u);
+
+    // the checks kept run
+    policy::on_fail_count::reset();
+    probability const none(FPT(0));
+    auto const quotient = probability(FPT(1)) / none;
+    BOOST_CHECK_EQUAL(quotient.get_stored_value(), std::numeric_limits<FPT>::infinity());
+    BOOST_CHECK(policy::on_fail_count::count() > 0);
+    policy::on_fail_count::reset();
+    probability const tiny(std::numeric_limits<FPT>::min());
+    tiny * probability(FPT(0.5));
+    BOOST_CHECK(policy::on_fail_count::count() > 0);
+
+    // a value kept out of its bounds is still checked by the operations
+    using finite = bounded_safe_float<FPT, zero, largest<FPT>, policy::check_all, policy::on_fail_count>;
+    policy::on_fail_count::reset();
+    finite const huge(std::numeric_limits<FPT>::max());
+    auto const sum = huge + huge;
+    BOOST_CHECK_EQUAL(sum.get_stored_value(), std::numeric_limits<FPT>::infinity());
+    BOOST_CHECK(policy::on_fail_count::count() > 0);
+    policy::on_fail_count::reset();
+    finite const outside(std::numeric_limits<FPT>::infinity());
+    BOOST_CHECK_EQUAL(policy::on_fail_count::count(), 1u);
+    outside - outside;
+    BOOST_CHECK(policy::on_fail_count::count() > 1u);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
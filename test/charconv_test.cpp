@@ -0,0 +1,221 @@
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <boost/mpl/list.hpp>
+
+#include <iomanip>
+#include <iterator>
+#include <limits>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <boost/safe_float.hpp>
+#include <boost/safe_float/charconv.hpp>
+#include <boost/safe_float/policy/on_fail_count.hpp>
+
+//types to be tested
+using test_types=boost::mpl::list<
+    float, double, long double
+>;
+
+using namespace boost::safe_float;
+
+template<class SF>
+std::from_chars_result parse(const std::string& text, SF& value,
+                             std::chars_format format = std::chars_format::general)
+{
+    return from_chars(text.data(), text.data() + text.size(), value, format);
+}
+
+/**
+  This test suite checks the conversions from characters are checked as the operations of the policies,
+  for single numbers, bulk parsing and streams, and the conversions to characters round trip.
+  */
+BOOST_AUTO_TEST_SUITE( charconv_test_suite )
+
+BOOST_AUTO_TEST_CASE_TEMPLATE( from_chars_exact_numbers, FPT, test_types){
+    safe_float<FPT> value;
+    std::pair<const char*, FPT> const numbers[] = {
+        {"0", FPT(0)}, {"-0", FPT(-0.0)}, {"0.5", FPT(0.5)}, {"-2.75", FPT(-2.75)}, {"1e3", FPT(1000)},
+        {"0.0625e2", FPT(6.25)}, {"12345678", FPT(12345678)}, {"1.5 rest", FPT(1.5)}};
+    for (const auto& number : numbers)
+    {
+        BOOST_CHECK(parse(number.first, value).ec == std::errc());
+        BOOST_CHECK_EQUAL(value.get_stored_value(), number.second);
+    }
+    BOOST_CHECK(parse("1.8p1", value, std::chars_format::hex).ec == std::errc());
+    BOOST_CHECK_EQUAL(value.get_stored_value(), FPT(3));
+
+    // nothing is stored when there is no number
+    BOOST_CHECK(parse("x1", value).ec == std::errc::invalid_argument);
+    BOOST_CHECK_EQUAL(value.get_stored_value(), FPT(3));
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE( from_chars_checks_conversions, FPT, test_types){
+    using counted = safe_float<FPT, policy::check_all, policy::on_fail_count>;
+    counted value;
+    policy::on_fail_count::reset();
+    for (const char* text : {"0.1", "1.00000000000000000000000000000000000000000000000001", "3.3e-2", "1e-30"})
+    {
+        parse(text, value);
+    }
+    BOOST_CHECK_EQUAL(policy::on_fail_count::count(), 4u);
+
+    // long numbers are exact when their digits are the ones of the value
+    policy::on_fail_count::reset();
+    parse("1.00000000000000000000000000000000000000000000000000", value);
+    parse("0.000000000931322574615478515625", value);
+    parse("36028797018963968", value);
+    parse("1180591620717411303424", value);
+    BOOST_CHECK_EQUAL(policy::on_fail_count::count(), 0u);
+
+    // out of range numbers are stored as the operations give them
+    std::string const large = "1e" + std::to_string(std::numeric_limits<FPT>::max_exponent10 + 1);
+    BOOST_CHECK(parse(large, value).ec == std::errc::result_out_of_range);
+    BOOST_CHECK_EQUAL(value.get_stored_value(), std::numeric_limits<FPT>::infinity());
+    BOOST_CHECK(parse("-" + large, value).ec == std::errc::result_out_of_range);
+    BOOST_CHECK_EQUAL(value.get_stored_value(), -std::numeric_limits<FPT>::infinity());
+    std::string const tiny = "1e" + std::to_string(std::numeric_limits<FPT>::min_exponent10 - 30);
+    BOOST_CHECK(parse(tiny, value).ec == std::errc::result_out_of_range);
+    BOOST_CHECK_EQUAL(value.get_stored_value(), FPT(0));
+    BOOST_CHECK_EQUAL(policy::on_fail_count::count(), 3u);
+
+    // subnormal values are underflows, special values are overflows and invalid results
+    std::string const subnormal = "1e" + std::to_string(std::numeric_limits<FPT>::min_exponent10 - 2);
+    for (const char* text : {"inf", "-inf", "nan"}) parse(text, value);
+    parse(subnormal, value);
+    BOOST_CHECK_EQUAL(policy::on_fail_count::count(), 7u);
+
+    // only the failures the policy checks are reported
+    safe_float<FPT, policy::check_overflow> overflow_only;
+    BOOST_CHECK(parse("0.1", overflow_only).ec == std::errc());
+    BOOST_CHECK(parse(subnormal, overflow_only).ec == std::errc());
+    BOOST_CHECK_THROW(parse("inf", overflow_only), std::exception);
+    safe_float<FPT, policy::check_inexact_rounding> inexact_only;
+    BOOST_CHECK_NO_THROW(parse("0.5", inexact_only));
+    BOOST_CHECK_THROW(parse("0.2", inexact_only), std::exception);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE( parse_many_numbers, FPT, test_types){
+    using sf = safe_float<FPT, policy::check_overflow>;
+    std::string const text = "1.5, 2,-3.25\n4e2\t5 ,\r\n6\n";
+    std::vector<sf> values;
+    parse_many_result const parsed = parse_many<sf>(text.data(), text.data() + text.size(), std::back_inserter(values));
+    BOOST_CHECK(parsed.ec == std::errc());
+    BOOST_CHECK_EQUAL(parsed.count, 6u);
+    BOOST_CHECK(parsed.ptr == text.data() + text.size());
+    BOOST_REQUIRE_EQUAL(values.size(), 6u);
+    BOOST_CHECK_EQUAL(values[2].get_stored_value(), FPT(-3.25));
+    BOOST_CHECK_EQUAL(values[3].get_stored_value(), FPT(400));
+
+    // parsing stops at the first field that is not a number
+    std::string const broken = "1;2;x;4";
+    sf buffer[4];
+    parse_many_result const stopped = parse_many<sf>(broken.data(), broken.data() + broken.size(), buffer, ';');
+    BOOST_CHECK(stopped.ec == std::errc::invalid_argument);
+    BOOST_CHECK_EQUAL(stopped.count, 2u);
+    BOOST_CHECK_EQUAL(stopped.ptr - broken.data(), 4);
+    std::string const glued = "1,2x";
+    BOOST_CHECK(parse_many<sf>(glued.data(), glued.data() + glued.size(), buffer).ec == std::errc::invalid_argument);
+
+    std::string const overflowing = "1,1e99999";
+    BOOST_CHECK_THROW(parse_many<sf>(overflowing.data(), overflowing.data() + overflowing.size(), buffer),
+                      std::exception);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE( stream_input_is_checked, FPT, test_types){
+    safe_float<FPT> value;
+    std::istringstream exact("  +2.5 -0.125e1 x");
+    exact >> value;
+    BOOST_CHECK_EQUAL(value.get_stored_value(), FPT(2.5));
+    exact >> value;
+    BOOST_CHECK_EQUAL(value.get_stored_value(), FPT(-1.25));
+    exact >> value;
+    BOOST_CHECK(exact.fail());
+    BOOST_CHECK_EQUAL(value.get_stored_value(), FPT(-1.25));
+
+    // the characters stop where the number ends, as std::num_get reads them
+    std::istringstream glued("3x");
+    glued >> value;
+    BOOST_CHECK(!glued.fail());
+    BOOST_CHECK_EQUAL(value.get_stored_value(), FPT(3));
+    BOOST_CHECK_EQUAL(static_cast<char>(glued.get()), 'x');
+    std::istringstream operation("2-1");
+    operation >> value;
+    BOOST_CHECK_EQUAL(value.get_stored_value(), FPT(2));
+    BOOST_CHECK_EQUAL(static_cast<char>(operation.peek()), '-');
+
+    // a stream rounds the digits to the nearest value, the overflows are reported
+    std::istringstream rounded("0.1");
+    rounded >> value;
+    BOOST_CHECK_EQUAL(value.get_stored_value(), FPT(0.1L));
+    std::istringstream overflowing("1e99999");
+    BOOST_CHECK_THROW(overflowing >> value, std::exception);
+
+    safe_float<FPT, policy::check_division_by_zero> unchecked;
+    std::istringstream last("0.1");
+    last >> unchecked;
+    BOOST_CHECK(!last.fail());
+    BOOST_CHECK(last.eof());
+    BOOST_CHECK_EQUAL(unchecked.get_stored_value(), FPT(0.1L));
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE( to_chars_round_trips, FPT, test_types){
+    using sf = safe_float<FPT, policy::check_overflow>;
+    char buffer[64];
+    for (FPT number : {FPT(0.1), FPT(-1) / FPT(3), std::numeric_limits<FPT>::max(),
+                       std::numeric_limits<FPT>::denorm_min(), FPT(-0.0), FPT(1e10)})
+    {
+        sf const value(number);
+        std::to_chars_result const written = to_chars(buffer, buffer + sizeof(buffer), value);
+        BOOST_REQUIRE(written.ec == std::errc());
+        sf read;
+        BOOST_CHECK(from_chars(buffer, written.ptr, read).ptr == written.ptr);
+        BOOST_CHECK_EQUAL(read.get_stored_value(), number);
+    }
+    sf const value(FPT(2.5));
+    std::to_chars_result written = to_chars(buffer, buffer + sizeof(buffer), value, std::chars_format::scientific);
+    BOOST_CHECK_EQUAL(std::string(buffer, written.ptr), "2.5e+00");
+    written = to_chars(buffer, buffer + sizeof(buffer), value, std::chars_format::fixed, 3);
+    BOOST_CHECK_EQUAL(std::string(buffer, written.ptr), "2.500");
+    BOOST_CHECK(to_chars(buffer, buffer + 2, value).ec == std::errc::value_too_large);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE( format_many_values, FPT, test_types){
+    using sf = safe_float<FPT, policy::check_bothflow>;
+    std::vector<sf> const values{sf(FPT(1.5)), sf(FPT(-2)), sf(FPT(0.25))};
+    char buffer[32];
+    format_many_result written = format_many(buffer, buffer + sizeof(buffer), values.begin(), values.end());
+    BOOST_CHECK(written.ec == std::errc());
+    BOOST_CHECK_EQUAL(written.count, 3u);
+    BOOST_CHECK_EQUAL(std::string(buffer, written.ptr), "1.5,-2,0.25,");
+
+    // the values that fit are written whole
+    written = format_many(buffer, buffer + 8, values.begin(), values.end(), '\n');
+    BOOST_CHECK(written.ec == std::errc::value_too_large);
+    BOOST_CHECK_EQUAL(written.count, 2u);
+    BOOST_CHECK_EQUAL(std::string(buffer, written.ptr), "1.5\n-2\n");
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE( stream_output_matches_values, FPT, test_types){
+    const safe_float<FPT, policy::check_bothflow> value(-std::numeric_limits<FPT>::max() / FPT(3));
+    auto const same_output = [&value](auto manipulate) {
+        std::ostringstream written, expected;
+        manipulate(written);
+        manipulate(expected);
+        written << value;
+        expected << value.get_stored_value();
+        return written.str() == expected.str();
+    };
+    BOOST_CHECK(same_output([](std::ostream&) {}));
+    BOOST_CHECK(same_output([](std::ostream& out) { out.precision(std::numeric_limits<FPT>::max_digits10); }));
+    BOOST_CHECK(same_output([](std::ostream& out) { out << std::scientific; }));
+    BOOST_CHECK(same_output([](std::ostream& out) { out << std::fixed; }));
+    BOOST_CHECK(same_output([](std::ostream& out) { out << std::hexfloat; }));
+    BOOST_CHECK(same_output([](std::ostream& out) { out << std::uppercase << std::showpos; }));
+    BOOST_CHECK(same_output([](std::ostream& out) { out.width(40); }));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,137 @@
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <boost/mpl/list.hpp>
+
+#include <cmath>
+#include <limits>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <boost/safe_float.hpp>
+#include <boost/safe_float/cmath.hpp>
+#include <boost/safe_float/policy/on_fail_count.hpp>
+
+//types to be tested
+using test_types=boost::mpl::list<
+    float, double, long double
+>;
+
+using namespace boost::safe_float;
+
+/**
+  This test suite checks the checked overloads of the <cmath> functions report their domain, pole and range
+  errors and their inexact results, and the bulk variants compute and check as the scalar ones.
+  */
+BOOST_AUTO_TEST_SUITE( cmath_test_suite )
+
+BOOST_AUTO_TEST_CASE_TEMPLATE( function_values, FPT, test_types){
+    using sf = safe_float<FPT>;
+    BOOST_CHECK_EQUAL(sqrt(sf(FPT(4))).get_stored_value(), FPT(2));
+    BOOST_CHECK_EQUAL(exp(sf(FPT(0))).get_stored_value(), FPT(1));
+    BOOST_CHECK_EQUAL(log(sf(FPT(1))).get_stored_value(), FPT(0));
+    BOOST_CHECK_EQUAL(pow(sf(FPT(3)), sf(FPT(2))).get_stored_value(), FPT(9));
+    BOOST_CHECK_EQUAL(hypot(sf(FPT(3)), sf(FPT(4))).get_stored_value(), FPT(5));
+    BOOST_CHECK_EQUAL(atan2(sf(FPT(0)), sf(FPT(1))).get_stored_value(), FPT(0));
+    BOOST_CHECK_EQUAL(log(sf(FPT(2))).get_stored_value(), std::log(FPT(2)));
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE( function_errors, FPT, test_types){
+    using sf = safe_float<FPT>;
+    FPT const max = std::numeric_limits<FPT>::max();
+    // domain and pole errors are rejected before the function is computed
+    BOOST_CHECK_THROW(sqrt(sf(FPT(-1))), std::exception);
+    BOOST_CHECK_THROW(log(sf(FPT(-1))), std::exception);
+    BOOST_CHECK_THROW(pow(sf(FPT(-8)), sf(FPT(0.5))), std::exception);
+    BOOST_CHECK_EQUAL(pow(sf(FPT(-2)), sf(FPT(3))).get_stored_value(), FPT(-8));
+    BOOST_CHECK_THROW(log(sf(FPT(0))), std::exception);
+    BOOST_CHECK_THROW(pow(sf(FPT(0)), sf(FPT(-1))), std::exception);
+    BOOST_CHECK_NO_THROW(sqrt(sf(-FPT(0))));
+
+    // range errors are reported on the results
+    BOOST_CHECK_THROW(exp(sf(FPT(100000))), std::exception);
+    BOOST_CHECK_THROW(hypot(sf(max), sf(max)), std::exception);
+    BOOST_CHECK_THROW(pow(sf(FPT(10)), sf(FPT(100000))), std::exception);
+    BOOST_CHECK_THROW(exp(sf(FPT(-100000))), std::exception);
+    BOOST_CHECK_THROW(pow(sf(FPT(0.5)), sf(FPT(100000))), std::exception);
+    BOOST_CHECK_NO_THROW(hypot(sf(std::numeric_limits<FPT>::denorm_min()), sf(FPT(0))));
+    BOOST_CHECK_NO_THROW(exp(sf(-std::numeric_limits<FPT>::infinity())));
+
+    // the report policy of the value receives the failures
+    using counted = safe_float<FPT, policy::check_all, policy::on_fail_count>;
+    policy::on_fail_count::reset();
+    BOOST_CHECK(std::isnan(sqrt(counted(FPT(-1))).get_stored_value()));
+    BOOST_CHECK_EQUAL(policy::on_fail_count::count(), 1u);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE( function_policies, FPT, test_types){
+    // only the function checks composed in the policy run
+    using domain = safe_float<FPT, policy::check_domain_error>;
+    BOOST_CHECK_THROW(sqrt(domain(FPT(-1))), std::exception);
+    BOOST_CHECK_NO_THROW(log(domain(FPT(0))));
+    using overflow = safe_float<FPT, policy::check_overflow>;
+    BOOST_CHECK_NO_THROW(sqrt(overflow(FPT(-1))));
+    using inexact = safe_float<FPT, policy::check_inexact_rounding>;
+    BOOST_CHECK_NO_THROW(exp(inexact(FPT(1))));
+    static_assert(noexcept(sqrt(std::declval<const inexact&>())), "");
+    static_assert(!noexcept(sqrt(std::declval<const domain&>())), "");
+
+    // the checks of the operators imply the function checks of the same failures
+    BOOST_CHECK_THROW(exp(overflow(FPT(100000))), std::exception);
+    BOOST_CHECK_NO_THROW(exp(overflow(FPT(-100000))));
+    using bothflow = safe_float<FPT, policy::check_bothflow>;
+    BOOST_CHECK_THROW(exp(bothflow(FPT(-100000))), std::exception);
+    using invalid = safe_float<FPT, policy::check_invalid_result>;
+    BOOST_CHECK_THROW(sqrt(invalid(FPT(-1))), std::exception);
+    BOOST_CHECK_NO_THROW(log(invalid(FPT(0))));
+    using divided = safe_float<FPT, policy::check_division_by_zero>;
+    BOOST_CHECK_THROW(log(divided(FPT(0))), std::exception);
+    static_assert(!noexcept(sqrt(std::declval<const overflow&>())), "");
+
+    using exact = safe_float<FPT, policy::compose_check<policy::check_function_errors,
+                                                        policy::check_function_inexact>::policy>;
+    BOOST_CHECK_NO_THROW(sqrt(exact(FPT(0.25))));
+    BOOST_CHECK_THROW(sqrt(exact(FPT(2))), std::exception);
+    BOOST_CHECK_NO_THROW(hypot(exact(FPT(5)), exact(FPT(12))));
+    BOOST_CHECK_THROW(hypot(exact(FPT(1)), exact(FPT(1))), std::exception);
+    BOOST_CHECK_NO_THROW(pow(exact(FPT(3)), exact(FPT(2))));
+    BOOST_CHECK_THROW(exp(exact(FPT(1))), std::exception);
+    BOOST_CHECK_THROW(atan2(exact(FPT(0)), exact(FPT(-1))), std::exception);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE( bulk_functions, FPT, test_types){
+    using sf = safe_float<FPT>;
+    std::size_t const count = 1000;
+    std::vector<sf> x(count), y(count), result(count);
+    for (std::size_t i = 0; i != count; ++i)
+    {
+        x[i] = sf(FPT(i));
+        y[i] = sf(FPT(2));
+    }
+    sqrt_n(x.data(), count, result.data());
+    for (std::size_t i = 0; i != count; ++i)
+        BOOST_CHECK_EQUAL(result[i].get_stored_value(), std::sqrt(FPT(i)));
+    pow_n(x.data(), y.data(), count, result.data());
+    for (std::size_t i = 0; i != count; ++i)
+        BOOST_CHECK_EQUAL(result[i].get_stored_value(), FPT(i) * FPT(i));
+    // the results may be written over the arguments
+    hypot_n(x.data(), y.data(), count, x.data());
+    BOOST_CHECK_EQUAL(x[0].get_stored_value(), FPT(2));
+
+    // a failing element is reported as the scalar call reports it
+    std::vector<sf> z(count, sf(FPT(1)));
+    z[700] = sf(FPT(-1));
+    BOOST_CHECK_THROW(log_n(z.data(), count, result.data()), std::exception);
+    using counted = safe_float<FPT, policy::check_all, policy::on_fail_count>;
+    std::vector<counted> c(count, counted(FPT(4))), r(count);
+    c[3] = counted(FPT(-4));
+    c[500] = counted(FPT(0));
+    policy::on_fail_count::reset();
+    log_n(c.data(), count, r.data());
+    BOOST_CHECK_EQUAL(policy::on_fail_count::count(), 2u);
+    BOOST_CHECK_EQUAL(r[1].get_stored_value(), std::log(FPT(4)));
+    BOOST_CHECK(std::isnan(r[3].get_stored_value()));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
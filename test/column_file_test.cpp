@@ -0,0 +1,149 @@
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <boost/mpl/list.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include <boost/safe_float/column_file.hpp>
+#include <boost/safe_float/policy/on_fail_count.hpp>
+
+//types to be tested
+using test_types=boost::mpl::list<
+    float, double, long double
+>;
+
+using namespace boost::safe_float;
+
+std::string column_path()
+{
+    return (std::filesystem::temp_directory_path() / "safe_float_column_test.col").string();
+}
+
+/**
+  This test suite checks columns are read in place as written, the statistics of the blocks select the
+  blocks to read, and the values the policy of the reader rejects are reported.
+  */
+BOOST_AUTO_TEST_SUITE( column_file_test_suite )
+
+BOOST_AUTO_TEST_CASE_TEMPLATE( column_values_and_statistics, FPT, test_types){
+    using sf = safe_float<FPT, policy::check_invalid_result, policy::on_fail_count>;
+    std::string const path = column_path();
+    std::size_t const n = 1000;
+    std::vector<sf> values;
+    for (std::size_t i = 0; i != n; ++i) values.emplace_back(FPT(i));
+    values[150] = sf(std::numeric_limits<FPT>::quiet_NaN());
+    {
+        column_writer<sf> writer(path, 100);
+        writer.append(values.data(), 500);
+        writer.append(values.data() + 500, n - 500);
+    }
+
+    policy::on_fail_count::reset();
+    column_file<sf> const column(path);
+    BOOST_CHECK_EQUAL(policy::on_fail_count::count(), 1u);
+    BOOST_CHECK_EQUAL(column.size(), n);
+    BOOST_CHECK_EQUAL(column.block_count(), 10u);
+    BOOST_CHECK_EQUAL(column.values()[999].get_stored_value(), FPT(999));
+    BOOST_CHECK_EQUAL(reinterpret_cast<std::uintptr_t>(column.values()) % 64, 0u);
+    BOOST_CHECK_EQUAL(column.block(1).nan_count, 1u);
+    BOOST_CHECK_EQUAL(column.block(1).lowest, FPT(100));
+    BOOST_CHECK_EQUAL(column.block(1).highest, FPT(199));
+    BOOST_CHECK_EQUAL(column.block_data(3)[5].get_stored_value(), FPT(305));
+
+    // blocks are selected from their statistics alone
+    BOOST_CHECK((column.blocks_in_range(FPT(250), FPT(420)) == std::vector<std::size_t>{2, 3, 4}));
+    BOOST_CHECK(column.blocks_in_range(FPT(2000), FPT(3000)).empty());
+    BOOST_CHECK((column.select_blocks([](const column_block<FPT>& block) { return block.nan_count != 0; })
+                 == std::vector<std::size_t>{1}));
+
+    // a partial last block
+    {
+        column_writer<sf> writer(path, 64);
+        writer.append(values.data() + 200, 70);
+        writer.close();
+    }
+    column_file<sf> const partial(path);
+    BOOST_CHECK_EQUAL(partial.block_count(), 2u);
+    BOOST_CHECK_EQUAL(partial.block_size(1), 6u);
+    BOOST_CHECK_EQUAL(partial.block(1).highest, FPT(269));
+    std::remove(path.c_str());
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE( column_validation, FPT, test_types){
+    using unchecked = safe_float<FPT, policy::check_division_by_zero>;
+    using checked = safe_float<FPT, policy::check_invalid_result, policy::on_fail_count>;
+    std::string const path = column_path();
+    std::vector<unchecked> values(300, unchecked(FPT(1)));
+    values[10] = unchecked(std::numeric_limits<FPT>::quiet_NaN());
+    values[290] = unchecked(std::numeric_limits<FPT>::quiet_NaN());
+    values[20] = unchecked(std::numeric_limits<FPT>::infinity());
+    {
+        column_writer<unchecked> writer(path, 128);
+        writer.append(values.data(), values.size());
+    }
+    policy::on_fail_count::reset();
+    column_file<checked> const column(path);
+    BOOST_CHECK_EQUAL(policy::on_fail_count::count(), 1u);
+
+    // the writer's policy checked the invalid results of its operations, not the values it stored
+    {
+        column_writer<checked> writer(path, 128);
+        for (const unchecked& value : values) writer.append(checked(value.get_stored_value()));
+    }
+    policy::on_fail_count::reset();
+    column_file<checked> const stored(path);
+    BOOST_CHECK_EQUAL(policy::on_fail_count::count(), 1u);
+
+    // corrupted counts are rejected before they are used
+    detail::column_header header;
+    {
+        std::ifstream file(path, std::ios::binary);
+        file.read(reinterpret_cast<char*>(&header), sizeof(header));
+    }
+    auto const patched = [&](std::size_t offset, std::uint64_t value, std::size_t size) {
+        {
+            std::fstream file(path, std::ios::binary | std::ios::in | std::ios::out);
+            file.seekp(static_cast<std::streamoff>(offset));
+            file.write(reinterpret_cast<const char*>(&value), static_cast<std::streamsize>(size));
+        }
+        bool rejected = false;
+        try
+        {
+            column_file<checked> const column(path);
+        }
+        catch (const std::invalid_argument&)
+        {
+            rejected = true;
+        }
+        return rejected;
+    };
+    std::uint64_t const huge = std::numeric_limits<std::uint64_t>::max() / 4 + 1;
+    BOOST_CHECK(patched(offsetof(detail::column_header, count), huge, sizeof(std::uint64_t)));
+    BOOST_CHECK(! patched(offsetof(detail::column_header, count), header.count, sizeof(std::uint64_t)));
+    BOOST_CHECK(patched(offsetof(detail::column_header, blocks), huge, sizeof(std::uint64_t)));
+    BOOST_CHECK(! patched(offsetof(detail::column_header, blocks), header.blocks, sizeof(std::uint64_t)));
+    std::size_t const last_block = header.statistics_offset + 2 * sizeof(column_block<FPT>);
+    BOOST_CHECK(patched(last_block + offsetof(column_block<FPT>, values), 128, sizeof(std::uint32_t)));
+    BOOST_CHECK(! patched(last_block + offsetof(column_block<FPT>, values), 44, sizeof(std::uint32_t)));
+    BOOST_CHECK(patched(last_block + offsetof(column_block<FPT>, nan_count), 45, sizeof(std::uint32_t)));
+    BOOST_CHECK(! patched(last_block + offsetof(column_block<FPT>, nan_count), 1, sizeof(std::uint32_t)));
+
+    // other types and truncated files are rejected
+    using other = safe_float<std::conditional_t<std::is_same<FPT, float>::value, double, float>,
+                             policy::check_invalid_result>;
+    BOOST_CHECK_THROW(column_file<other>{path}, std::invalid_argument);
+    std::filesystem::resize_file(path, std::filesystem::file_size(path) - 1);
+    BOOST_CHECK_THROW(column_file<checked>{path}, std::invalid_argument);
+    std::remove(path.c_str());
+    BOOST_CHECK_THROW(column_file<checked>{path}, std::system_error);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
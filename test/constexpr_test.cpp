@@ -0,0 +1,67 @@
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <boost/mpl/list.hpp>
+
+#include <limits>
+
+#include <boost/safe_float.hpp>
+#include <boost/safe_float/literals.hpp>
+
+//types to be tested
+using test_types=boost::mpl::list<
+    float, double, long double
+>;
+
+using namespace boost::safe_float;
+
+// every operation of a table computed at compile time
+template<class SF>
+constexpr SF sum_of_operations(SF lhs, SF rhs){
+    SF result = lhs + rhs;
+    result += lhs - rhs;
+    result += lhs * rhs;
+    result += lhs / rhs;
+    return -result;
+}
+
+/**
+  This test suite checks the operations can be evaluated at compile time with the value checks.
+  */
+BOOST_AUTO_TEST_SUITE( safe_float_constexpr_test_suite )
+
+BOOST_AUTO_TEST_CASE_TEMPLATE( safe_float_constexpr_arithmetic, FPT, test_types){
+    using sf = safe_float<FPT>;
+    constexpr sf lhs(FPT(1.5));
+    constexpr sf rhs(FPT(0.5));
+    constexpr sf result = sum_of_operations(lhs, rhs);
+    static_assert(result.get_stored_value() == FPT(-6.75));
+    static_assert(lhs > rhs && rhs < lhs && lhs >= lhs && rhs <= rhs && lhs != rhs && lhs == lhs);
+
+    // same result at runtime, where the checks may read the flags
+    sf runtime_lhs(FPT(1.5));
+    BOOST_CHECK(sum_of_operations(runtime_lhs, rhs) == result);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE( safe_float_constexpr_numeric_limits, FPT, test_types){
+    using sf = safe_float<FPT>;
+    using limits = std::numeric_limits<sf>;
+    static_assert(limits::max().get_stored_value() == std::numeric_limits<FPT>::max());
+    static_assert(limits::lowest().get_stored_value() == std::numeric_limits<FPT>::lowest());
+    static_assert(limits::min().get_stored_value() == std::numeric_limits<FPT>::min());
+    static_assert(limits::denorm_min().get_stored_value() == std::numeric_limits<FPT>::denorm_min());
+    static_assert(limits::epsilon() + sf(FPT(1)) > sf(FPT(1)));
+    BOOST_CHECK(true);
+}
+
+BOOST_AUTO_TEST_CASE( safe_float_constexpr_literals_table ){
+    using namespace boost::safe_float::literals;
+    constexpr safe_float<double> table[] = {1.5_sd, 1.25e-1_sd, 1.5_sd * 1.25e-1_sd, 1.5_sd / 1.25e-1_sd};
+    static_assert(table[2].get_stored_value() == 0.1875);
+    static_assert(table[3].get_stored_value() == 12.0);
+    constexpr safe_float<float> single = 3.125e-2_sf + 1.5_sf;
+    static_assert(single.get_stored_value() == 1.53125f);
+    BOOST_CHECK(true);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,93 @@
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <boost/mpl/list.hpp>
+
+#include <cfenv>
+#include <cmath>
+#include <functional>
+#include <limits>
+
+#include <boost/safe_float/detail/fenv_backend.hpp>
+
+//types to be tested
+using test_types=boost::mpl::list<
+    float, double, long double
+>;
+
+using namespace boost::safe_float;
+
+/**
+  This test suite checks the floating point environment backends behave as std::feclearexcept and std::fetestexcept.
+  */
+BOOST_AUTO_TEST_SUITE( safe_float_fenv_backend_test_suite )
+
+BOOST_AUTO_TEST_CASE( safe_float_fenv_backend_selection ){
+#if defined(__GNUC__) && defined(__x86_64__)
+    // On x86-64 float and double are computed by the SSE unit and long double by the x87 unit
+    BOOST_CHECK(detail::fenv_backend<float>::kind == detail::fenv_backend_kind::sse);
+    BOOST_CHECK(detail::fenv_backend<double>::kind == detail::fenv_backend_kind::sse);
+    if (std::numeric_limits<long double>::digits == 64)
+        BOOST_CHECK(detail::fenv_backend<long double>::kind == detail::fenv_backend_kind::x87);
+#else
+    BOOST_TEST_MESSAGE("No native backend expected for this platform");
+#endif
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE( safe_float_fenv_backend_mode, FPT, test_types){
+#if defined(FENV_AVAILABLE) && defined(BOOST_SAFE_FLOAT_FENV_USE_LIBC)
+    BOOST_CHECK(detail::fenv_mode_of<FPT> == detail::fenv_mode::libc);
+    BOOST_CHECK(detail::fenv_backend<FPT>::kind == detail::fenv_backend_kind::libc);
+#elif defined(FENV_AVAILABLE)
+    BOOST_CHECK(detail::fenv_mode_of<FPT> == detail::fenv_mode::native);
+#else
+    // unit tests are not built with the generated configuration, values are checked
+    BOOST_CHECK(detail::fenv_mode_of<FPT> == detail::fenv_mode::value_checks);
+    BOOST_CHECK(! detail::uses_fenv<FPT>);
+#endif
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE( safe_float_fenv_backend_test_flags, FPT, test_types){
+    using backend = detail::fenv_backend<FPT>;
+    volatile FPT max = std::numeric_limits<FPT>::max();
+    volatile FPT zero = FPT(0);
+    volatile FPT one = FPT(1);
+
+    // clear every flag handled
+    BOOST_CHECK(! backend::clearexcept(FE_ALL_EXCEPT));
+    BOOST_CHECK(! backend::testexcept(FE_ALL_EXCEPT));
+
+    // overflow is raised and seen by the backend as it is seen by libc
+    volatile FPT r = max * max;
+    BOOST_CHECK(backend::testexcept(FE_OVERFLOW));
+    BOOST_CHECK(std::fetestexcept(FE_OVERFLOW));
+    BOOST_CHECK(! backend::testexcept(FE_DIVBYZERO));
+
+    // only the requested flag is cleared
+    BOOST_CHECK(! backend::clearexcept(FE_OVERFLOW));
+    BOOST_CHECK(! backend::testexcept(FE_OVERFLOW));
+    BOOST_CHECK(! std::fetestexcept(FE_OVERFLOW));
+    BOOST_CHECK(backend::testexcept(FE_INEXACT));
+
+    // several flags at once
+    r = one / zero;
+    r = zero / zero;
+    BOOST_CHECK_EQUAL(backend::testexcept(FE_DIVBYZERO | FE_INVALID | FE_UNDERFLOW), FE_DIVBYZERO | FE_INVALID);
+    BOOST_CHECK(! backend::clearexcept(FE_ALL_EXCEPT));
+    BOOST_CHECK(! backend::testexcept(FE_ALL_EXCEPT));
+    (void)r;
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE( safe_float_fenv_backend_ordered_operation, FPT, test_types){
+    using backend = detail::fenv_backend<FPT>;
+    FPT max = std::numeric_limits<FPT>::max();
+
+    // the operation can't be moved before the flags are cleared
+    backend::clearexcept(FE_OVERFLOW);
+    FPT r = detail::fenv_ordered(max, max, std::plus<FPT>{});
+    BOOST_CHECK(backend::testexcept(FE_OVERFLOW));
+    BOOST_CHECK(std::isinf(r));
+    backend::clearexcept(FE_ALL_EXCEPT);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,127 @@
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <boost/mpl/list.hpp>
+
+#include <cmath>
+#include <limits>
+
+#include <boost/safe_float.hpp>
+#include <boost/safe_float/flush_to_zero.hpp>
+#include <boost/safe_float/policy/on_fail_count.hpp>
+
+//types to be tested
+using test_types=boost::mpl::list<
+    float, double, long double
+>;
+
+using namespace boost::safe_float;
+
+template<class FPT>
+constexpr bool flushes = detail::native_fenv_backend<FPT>::type::kind == detail::fenv_backend_kind::sse;
+
+/**
+  This test suite checks the flush to zero scope and the policy detecting the flushed values.
+  */
+BOOST_AUTO_TEST_SUITE( safe_float_flush_to_zero_test_suite )
+
+BOOST_AUTO_TEST_CASE( safe_float_flush_to_zero_scope_restores ){
+    BOOST_CHECK(! flush_to_zero_scope::active());
+    {
+        flush_to_zero_scope scope;
+#if defined(BOOST_SAFE_FLOAT_HAS_SSE_FLOAT) || defined(BOOST_SAFE_FLOAT_HAS_SSE_DOUBLE)
+        BOOST_CHECK(flush_to_zero_scope::active());
+#endif
+        BOOST_CHECK(! scope.flushed());
+    }
+    BOOST_CHECK(! flush_to_zero_scope::active());
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE( safe_float_flush_to_zero_scope_flushes, FPT, test_types){
+    volatile FPT min = std::numeric_limits<FPT>::min();
+    volatile FPT r = min / FPT(4);
+    BOOST_CHECK(std::fpclassify(r) == FP_SUBNORMAL);
+    {
+        flush_to_zero_scope scope;
+        r = min / FPT(4);
+        if (flushes<FPT>) {
+            BOOST_CHECK_EQUAL(r, FPT(0));
+            BOOST_CHECK(scope.flushed());
+        } else {
+            BOOST_CHECK(std::fpclassify(r) == FP_SUBNORMAL);
+        }
+    }
+    r = min / FPT(4);
+    BOOST_CHECK(std::fpclassify(r) == FP_SUBNORMAL);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE( safe_float_check_flush_to_zero_policy, FPT, test_types){
+    using sf = safe_float<FPT, policy::check_flush_to_zero>;
+    sf min = std::numeric_limits<FPT>::min();
+    sf subnormal = std::numeric_limits<FPT>::denorm_min();
+    sf four = FPT(4);
+
+    // outside the scope subnormal results are reported as underflows
+    BOOST_CHECK_THROW(min / four, std::exception);
+    BOOST_CHECK_NO_THROW(min * four);
+    BOOST_CHECK_NO_THROW(four - four);
+
+    flush_to_zero_scope scope;
+    // flushed results are reported
+    BOOST_CHECK_THROW(min / four, std::exception);
+    BOOST_CHECK_THROW(min * (four / four / four / four), std::exception);
+    BOOST_CHECK_NO_THROW(min * four);
+    BOOST_CHECK_NO_THROW(four + four);
+    // subnormal operands are reported when they are read as zero
+    if (flushes<FPT>)
+        BOOST_CHECK_THROW(subnormal + four, std::exception);
+    else
+        BOOST_CHECK_NO_THROW(subnormal + four);
+
+    //check error message
+    policy::check_flush_to_zero<FPT> check;
+    BOOST_CHECK_EQUAL(check.addition_failure_message(), std::string("Subnormal value flushed to zero on addition operation"));
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE( safe_float_check_flush_to_zero_keeps_flag, FPT, test_types){
+    // the checks don't clear the flag the scope reports, the flushes counted stay visible
+    using sf = safe_float<FPT, policy::check_flush_to_zero, policy::on_fail_count>;
+    sf min = std::numeric_limits<FPT>::min();
+    sf four = FPT(4);
+    policy::on_fail_count::reset();
+    flush_to_zero_scope scope;
+    min / four;
+    four + four;
+    min * four;
+    if (flushes<FPT>) {
+        BOOST_CHECK(scope.flushed());
+        BOOST_CHECK_EQUAL(policy::on_fail_count::count(), 1u);
+    }
+    // a flush following a flush is still detected
+    min / four;
+    if (flushes<FPT>)
+        BOOST_CHECK_EQUAL(policy::on_fail_count::count(), 2u);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE( safe_float_check_flush_to_zero_composed, FPT, test_types){
+    // the checks run again to report the failure of another check, with the flag raised before the operation
+    using sf = safe_float<FPT, policy::compose_check<policy::check_flush_to_zero,
+                                                     policy::check_addition_overflow>::policy, policy::on_fail_count>;
+    flush_to_zero_scope scope;
+    volatile FPT min = std::numeric_limits<FPT>::min();
+    volatile FPT r = min / FPT(4);
+    (void)r;
+    policy::on_fail_count::reset();
+    sf a = std::numeric_limits<FPT>::max();
+    a += a;
+    BOOST_CHECK_EQUAL(policy::on_fail_count::count(), 1u);
+    if (flushes<FPT>)
+        BOOST_CHECK(scope.flushed());
+    sf b = std::numeric_limits<FPT>::min();
+    b /= sf(FPT(4));
+    BOOST_CHECK_EQUAL(policy::on_fail_count::count(), 2u);
+    if (flushes<FPT>)
+        BOOST_CHECK(scope.flushed());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,82 @@
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <boost/mpl/list.hpp>
+
+#include <cstring>
+#include <memory>
+#include <string>
+#include <type_traits>
+
+#include <boost/safe_float/buffer.hpp>
+#include <boost/safe_float/policy/check_flush_to_zero.hpp>
+#include <boost/safe_float/policy/check_subnormal_operand.hpp>
+#include <boost/safe_float/policy/on_fail_count.hpp>
+
+//types to be tested
+using test_types=boost::mpl::list<
+    float, double, long double
+>;
+
+using namespace boost::safe_float;
+
+// A report policy keeping the last message
+struct on_fail_keep : policy::on_fail_policy {
+    std::string message;
+    void report_failure(const std::string& s) { message = s; }
+};
+
+template<class SF>
+constexpr bool has_value_layout = std::is_trivially_copyable_v<SF> && std::is_standard_layout_v<SF>
+                                  && sizeof(SF) == sizeof(typename SF::value_type)
+                                  && alignof(SF) == alignof(typename SF::value_type);
+
+/**
+  This test suite checks safe floats with stateless report policies have the layout of their value.
+  */
+BOOST_AUTO_TEST_SUITE( safe_float_layout_test_suite )
+
+BOOST_AUTO_TEST_CASE_TEMPLATE( safe_float_layout_stateless_policies, FPT, test_types){
+    static_assert(has_value_layout<safe_float<FPT, policy::check_addition_invalid_result>>);
+    static_assert(has_value_layout<safe_float<FPT, policy::check_division_by_zero, policy::on_fail_count>>);
+    static_assert(has_value_layout<safe_float<FPT, policy::check_subnormal_operand>>);
+    static_assert(has_value_layout<safe_float<FPT, policy::check_flush_to_zero>>);
+
+    // composing stateless policies keeps the layout
+    static_assert(has_value_layout<safe_float<FPT, policy::check_invalid_result>>);
+    static_assert(is_layout_compatible_v<safe_float<FPT, policy::check_invalid_result>>);
+
+    // the checks keeping the operands run on a new policy at each operation, the safe float only stores its value
+    static_assert(has_value_layout<safe_float<FPT, policy::check_all>>);
+    static_assert(is_layout_compatible_v<safe_float<FPT, policy::check_all>>);
+    static_assert(! is_layout_compatible_v<safe_float<FPT, policy::check_all, on_fail_keep>>);
+    static_assert(! is_layout_compatible_v<FPT>);
+    BOOST_CHECK(true);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE( safe_float_layout_views, FPT, test_types){
+    using sf = safe_float<FPT, policy::check_invalid_result>;
+    constexpr std::size_t size = 16;
+
+    // storage from an allocation function, filled as a read from a socket would
+    FPT source[size];
+    for (std::size_t i = 0; i < size; ++i) source[i] = FPT(i);
+    std::unique_ptr<FPT[]> buffer(new FPT[size]);
+    std::memcpy(buffer.get(), source, sizeof(source));
+
+    // the values are FPT objects, viewing them as writable values starts the lifetime of the safe floats
+    sf* checked = as_safe<sf>(buffer.get(), size);
+    for (std::size_t i = 1; i < size; ++i) checked[i] += checked[i - 1];
+    BOOST_CHECK_EQUAL(buffer[size - 1], FPT(size * (size - 1) / 2));
+
+    FPT* raw = as_raw(checked);
+    BOOST_CHECK(raw == buffer.get());
+    raw[0] = FPT(-1);
+    BOOST_CHECK(checked[0].get_stored_value() == FPT(-1));
+
+    const FPT* const_raw = buffer.get();
+    const sf* const_checked = as_safe<sf>(const_raw, size);
+    BOOST_CHECK(as_raw(const_checked) == const_raw);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
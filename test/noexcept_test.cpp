@@ -0,0 +1,89 @@
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <boost/mpl/list.hpp>
+
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <boost/safe_float.hpp>
+#include <boost/safe_float/policy/on_fail_count.hpp>
+
+//types to be tested
+using test_types=boost::mpl::list<
+    float, double, long double
+>;
+
+using namespace boost::safe_float;
+
+// report policy that may throw, but does not say it
+class on_fail_ignore_unchecked {
+public:
+    void report_failure(const std::string&) {}
+};
+
+template<class SF>
+constexpr bool nothrow_arithmetic = noexcept(std::declval<SF&>() += std::declval<const SF&>())
+                                    && noexcept(std::declval<SF&>() -= std::declval<const SF&>())
+                                    && noexcept(std::declval<SF&>() *= std::declval<const SF&>())
+                                    && noexcept(std::declval<SF&>() /= std::declval<const SF&>())
+                                    && noexcept(std::declval<SF>() + std::declval<const SF&>())
+                                    && noexcept(std::declval<SF>() - std::declval<const SF&>())
+                                    && noexcept(std::declval<SF>() * std::declval<const SF&>())
+                                    && noexcept(std::declval<SF>() / std::declval<const SF&>());
+
+/**
+  This test suite checks the operations are noexcept when the policies can't throw.
+  */
+BOOST_AUTO_TEST_SUITE( safe_float_noexcept_test_suite )
+
+BOOST_AUTO_TEST_CASE_TEMPLATE( safe_float_nothrow_with_nothrow_report, FPT, test_types){
+    using sf = safe_float<FPT, policy::check_all, policy::on_fail_count>;
+    static_assert(std::is_nothrow_default_constructible_v<sf>);
+    static_assert(std::is_nothrow_constructible_v<sf, FPT>);
+    static_assert(std::is_nothrow_copy_constructible_v<sf>);
+    static_assert(std::is_nothrow_move_constructible_v<sf>);
+    static_assert(std::is_nothrow_copy_assignable_v<sf>);
+    static_assert(std::is_nothrow_move_assignable_v<sf>);
+    static_assert(nothrow_arithmetic<sf>);
+    static_assert(noexcept(-std::declval<const sf&>()));
+    static_assert(noexcept(std::declval<const sf&>() < std::declval<const sf&>()));
+
+    // single and composed policies
+    static_assert(nothrow_arithmetic<safe_float<FPT, policy::check_addition_overflow, policy::on_fail_count>>);
+    static_assert(nothrow_arithmetic<safe_float<FPT, policy::check_overflow, policy::on_fail_policy>>);
+
+    // casts between primitives are nothrow
+    using sf_cast = safe_float<FPT, policy::check_all, policy::on_fail_count, policy::cast_to_primitive::same>;
+    static_assert(noexcept(static_cast<FPT>(std::declval<sf_cast&>())));
+
+    // the vector moves the elements when growing, it copies them when the move may throw
+    static_assert(std::is_same_v<decltype(std::move_if_noexcept(std::declval<sf&>())), sf&&>);
+    std::vector<sf> values(4, sf(FPT(1)));
+    sf const* const storage = values.data();
+    values.reserve(64);
+    BOOST_CHECK(values.data() != storage);
+    BOOST_CHECK_EQUAL(values.size(), 4u);
+    for (const sf& value : values) BOOST_CHECK_EQUAL(value.get_stored_value(), FPT(1));
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE( safe_float_throw_with_throwing_report, FPT, test_types){
+    using sf = safe_float<FPT, policy::check_all, policy::on_fail_throw>;
+    static_assert(std::is_nothrow_constructible_v<sf, FPT>);
+    static_assert(std::is_nothrow_move_constructible_v<sf>);
+    static_assert(! noexcept(std::declval<sf&>() += std::declval<const sf&>()));
+    static_assert(! noexcept(std::declval<sf>() / std::declval<const sf&>()));
+
+    // a report_failure that is not declared noexcept is assumed to throw
+    using sf_unchecked = safe_float<FPT, policy::check_all, on_fail_ignore_unchecked>;
+    static_assert(! noexcept(std::declval<sf_unchecked&>() += std::declval<const sf_unchecked&>()));
+
+    // a policy without checks for an operation never reports it
+    using sf_division = safe_float<FPT, policy::check_division_by_zero, policy::on_fail_throw>;
+    static_assert(noexcept(std::declval<sf_division&>() += std::declval<const sf_division&>()));
+    static_assert(! noexcept(std::declval<sf_division&>() /= std::declval<const sf_division&>()));
+    BOOST_CHECK(true);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
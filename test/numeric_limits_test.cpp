@@ -53,18 +53,18 @@ BOOST_AUTO_TEST_CASE_TEMPLATE( safe_float_numeric_limits_basic_fp_types, FPT, te
     BOOST_CHECK(std::numeric_limits<number_type>::traps == std::numeric_limits<FPT>::traps);
     BOOST_CHECK(std::numeric_limits<number_type>::tinyness_before == std::numeric_limits<FPT>::tinyness_before);
 
-    //if safe_float has a policy declaring inexact is handled in every operation it should be considered exact
+    //a policy rejecting the inexact results doesn't make the representation exact
     BOOST_CHECK(std::numeric_limits<number_type>::is_exact == std::numeric_limits<FPT>::is_exact);
-    BOOST_CHECK(std::numeric_limits<exact_number_type>::is_exact); //need to be implemented
+    BOOST_CHECK(std::numeric_limits<exact_number_type>::is_exact == std::numeric_limits<FPT>::is_exact);
 
     //The way NaNs are handled makes reference to the internal datatype
     BOOST_CHECK(std::numeric_limits<number_type>::has_quiet_NaN == std::numeric_limits<FPT>::has_quiet_NaN);
     BOOST_CHECK(std::numeric_limits<number_type>::has_signaling_NaN == std::numeric_limits<FPT>::has_signaling_NaN);
     BOOST_CHECK(std::numeric_limits<number_type>::round_style == std::numeric_limits<FPT>::round_style);
 
-    //round error is zero if the number is_exactly represented
+    //round error is the one of the internal datatype
     BOOST_CHECK(std::numeric_limits<number_type>::round_error().get_stored_value() == std::numeric_limits<FPT>::round_error());
-    BOOST_CHECK(std::numeric_limits<exact_number_type>::round_error().get_stored_value() == 0.0f);
+    BOOST_CHECK(std::numeric_limits<exact_number_type>::round_error().get_stored_value() == std::numeric_limits<FPT>::round_error());
 
     //check the special methods and attributes that are wrapped are internally the same values
     BOOST_CHECK(std::numeric_limits<number_type>::min().get_stored_value() == std::numeric_limits<FPT>::min());
@@ -72,8 +72,8 @@ BOOST_AUTO_TEST_CASE_TEMPLATE( safe_float_numeric_limits_basic_fp_types, FPT, te
     BOOST_CHECK(std::numeric_limits<number_type>::lowest().get_stored_value() == std::numeric_limits<FPT>::lowest());
     BOOST_CHECK(std::numeric_limits<number_type>::epsilon().get_stored_value() == std::numeric_limits<FPT>::epsilon());
     BOOST_CHECK(std::numeric_limits<number_type>::infinity().get_stored_value() == std::numeric_limits<FPT>::infinity());
-    BOOST_CHECK(std::numeric_limits<number_type>::quiet_NaN().get_stored_value() == std::numeric_limits<FPT>::quiet_NaN());
-    BOOST_CHECK(std::numeric_limits<number_type>::signaling_NaN().get_stored_value() == std::numeric_limits<FPT>::signaling_NaN());
+    BOOST_CHECK(std::isnan(std::numeric_limits<number_type>::quiet_NaN().get_stored_value()));
+    BOOST_CHECK(std::isnan(std::numeric_limits<number_type>::signaling_NaN().get_stored_value()));
     BOOST_CHECK(std::numeric_limits<number_type>::denorm_min().get_stored_value() == std::numeric_limits<FPT>::denorm_min());
 }
 
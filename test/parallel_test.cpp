@@ -0,0 +1,82 @@
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <boost/mpl/list.hpp>
+
+#include <atomic>
+#include <cfenv>
+#include <limits>
+#include <vector>
+
+#include <boost/safe_float.hpp>
+#include <boost/safe_float/parallel.hpp>
+#include <boost/safe_float/policy/on_fail_count.hpp>
+#include <boost/safe_float/rounding.hpp>
+
+//types to be tested
+using test_types=boost::mpl::list<
+    float, double, long double
+>;
+
+using namespace boost::safe_float;
+
+/**
+  This test suite checks the floating point state of the tasks is propagated to the joining thread.
+  */
+BOOST_AUTO_TEST_SUITE( safe_float_parallel_test_suite )
+
+BOOST_AUTO_TEST_CASE_TEMPLATE( safe_float_parallel_flags_propagated, FPT, test_types){
+    std::feclearexcept(FE_ALL_EXCEPT);
+    task_group group;
+    group.run([] {
+        volatile FPT max = std::numeric_limits<FPT>::max();
+        volatile FPT r = max * max;
+        (void)r;
+    });
+    group.run([] {
+        volatile FPT one = FPT(1);
+        volatile FPT r = one + one;
+        (void)r;
+    });
+    group.wait();
+    BOOST_CHECK(std::fetestexcept(FE_OVERFLOW));
+    BOOST_CHECK(! std::fetestexcept(FE_DIVBYZERO));
+    std::feclearexcept(FE_ALL_EXCEPT);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE( safe_float_parallel_counted_failures_merged, FPT, test_types){
+    using sf = safe_float<FPT, policy::check_division_by_zero, policy::on_fail_count>;
+    policy::on_fail_count::reset();
+    std::vector<sf> values(1000, sf(FPT(1)));
+    for (std::size_t i = 0; i < values.size(); i += 10) values[i] = sf(FPT(0));
+    std::atomic<int> visited{0};
+    parallel_for(std::size_t(0), values.size(), [&](std::size_t i) {
+        sf one = FPT(1);
+        one / values[i];
+        ++visited;
+    }, 4);
+    BOOST_CHECK_EQUAL(visited.load(), 1000);
+    BOOST_CHECK_EQUAL(policy::on_fail_count::count(), 100u);
+    policy::on_fail_count::reset();
+    std::feclearexcept(FE_ALL_EXCEPT);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE( safe_float_parallel_exception_rethrown, FPT, test_types){
+    using sf = safe_float<FPT, policy::check_overflow>;
+    std::vector<sf> values(64, sf(FPT(1)));
+    values[17] = std::numeric_limits<FPT>::max();
+    BOOST_CHECK_THROW(parallel_for(0, 64, [&](int i) { values[i] * values[i]; }, 4), std::exception);
+    BOOST_CHECK_NO_THROW(parallel_for(0, 16, [&](int i) { values[i] * values[i]; }, 4));
+    std::feclearexcept(FE_ALL_EXCEPT);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE( safe_float_parallel_environment_inherited, FPT, test_types){
+    rounding_scope scope(rounding_mode::upward);
+    std::atomic<bool> upward{true};
+    parallel_for(0, 8, [&](int) {
+        if (rounding_scope::current<FPT>() != rounding_mode::upward) upward = false;
+    }, 4);
+    BOOST_CHECK(upward.load());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
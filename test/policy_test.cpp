@@ -187,6 +187,14 @@ BOOST_AUTO_TEST_CASE_TEMPLATE( safe_float_check_all_inexactity_combined, FPT, te
     safe_float<FPT, policy::check_inexact_rounding> e = FPT(1);
     safe_float<FPT, policy::check_inexact_rounding> f(FPT(1.815170982922064060217925973717001397744752466678619384765625L));
     BOOST_CHECK_THROW(e/f, std::exception);
+
+    // NaN results are invalid, not inexact, as the flags report them
+    safe_float<FPT, policy::check_inexact_rounding> g(std::numeric_limits<FPT>::infinity());
+    safe_float<FPT, policy::check_inexact_rounding> h(FPT(0));
+    BOOST_CHECK_NO_THROW(g*h);
+    BOOST_CHECK_NO_THROW(g-g);
+    BOOST_CHECK_NO_THROW(h/h);
+    BOOST_CHECK_NO_THROW(g+(-g));
 }
 
 BOOST_AUTO_TEST_CASE_TEMPLATE( safe_float_check_all_invality_combined, FPT, test_types){
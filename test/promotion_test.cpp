@@ -0,0 +1,90 @@
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <boost/mpl/list.hpp>
+
+#include <limits>
+#include <type_traits>
+
+#include <boost/safe_float.hpp>
+#include <boost/safe_float/policy/on_fail_count.hpp>
+#include <boost/safe_float/policy/on_fail_poison.hpp>
+#include <boost/safe_float/policy/promotion.hpp>
+
+//types to be tested
+using test_types=boost::mpl::list<
+    float, double, long double
+>;
+
+using namespace boost::safe_float;
+
+template<class SF1, class SF2>
+using promoted = typename policy::promotion<SF1, SF2>::promoted;
+
+template<class CHECK, class POLICY>
+constexpr bool holds = policy::is_subset<CHECK, POLICY>::value;
+
+/**
+  This test suite checks the promotion of the operands of operations between different safe_float types, and the
+  mixed operations computed in the promoted type.
+  */
+BOOST_AUTO_TEST_SUITE( promotion_test_suite )
+
+BOOST_AUTO_TEST_CASE_TEMPLATE( promotion_lattice, FPT, test_types){
+    using narrow = safe_float<float, policy::check_overflow>;
+    using wide = safe_float<FPT, policy::check_overflow>;
+    static_assert(std::is_same<promoted<narrow, wide>, wide>::value, "");
+    static_assert(std::is_same<promoted<wide, narrow>, wide>::value, "");
+    static_assert(std::is_same<promoted<wide, wide>, wide>::value, "");
+
+    // a policy holding the other one names the promotion
+    using stronger = safe_float<float, policy::check_all>;
+    static_assert(std::is_same<promoted<wide, stronger>, safe_float<FPT, policy::check_all>>::value, "");
+    static_assert(std::is_same<typename policy::promotion<wide, stronger>::relaxed, wide>::value, "");
+
+    // the union of other policies checks both, the intersection what both check
+    using underflow = safe_float<float, policy::check_underflow>;
+    using both = typename promoted<wide, underflow>::check_policy;
+    static_assert(holds<policy::check_overflow<FPT>, both> && holds<policy::check_underflow<FPT>, both>, "");
+    using bothflow = safe_float<FPT, policy::check_bothflow>;
+    using mixed = safe_float<float, policy::compose_check<policy::check_underflow,
+                                                          policy::check_division_by_zero>::policy>;
+    using common = typename policy::promotion<bothflow, mixed>::relaxed::check_policy;
+    static_assert(holds<policy::check_underflow<FPT>, common>, "");
+    static_assert(!holds<policy::check_addition_overflow<FPT>, common>, "");
+    static_assert(!holds<policy::check_division_by_zero<FPT>, common>, "");
+
+    // the report policy stopping the operations is kept, others are not promoted
+    using counted = safe_float<float, policy::check_overflow, policy::on_fail_count>;
+    static_assert(std::is_same<typename promoted<counted, wide>::report_policy, policy::on_fail_throw>::value, "");
+    using poisoned = safe_float<FPT, policy::check_overflow, policy::on_fail_poison>;
+    static_assert(!policy::promotion<counted, poisoned>::accept_promotion, "");
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE( mixed_operations, FPT, test_types){
+    using narrow = safe_float<float>;
+    using wide = safe_float<FPT, policy::check_overflow>;
+    narrow const a(0.5f);
+    wide const b(FPT(2));
+    auto const sum = a + b;
+    static_assert(std::is_same<std::remove_const_t<decltype(sum)>, safe_float<FPT>>::value, "");
+    BOOST_CHECK_EQUAL(sum.get_stored_value(), FPT(2.5));
+    BOOST_CHECK_EQUAL((b - a).get_stored_value(), FPT(1.5));
+    BOOST_CHECK_EQUAL((b * b * a).get_stored_value(), FPT(2));
+    BOOST_CHECK_EQUAL((b / a).get_stored_value(), FPT(4));
+
+    // the checks of both operands run in the promoted type
+    BOOST_CHECK_THROW(b + narrow(1e-30f), std::exception);
+    using checked = safe_float<float, policy::check_division_by_zero>;
+    BOOST_CHECK_THROW(b / checked(0.f), std::exception);
+    wide const large(std::numeric_limits<FPT>::max());
+    BOOST_CHECK_THROW(large * checked(2.f), std::exception);
+
+    // compound assignments keep the left operand when it is the promoted type
+    safe_float<FPT, policy::check_all> c(FPT(1));
+    c += safe_float<float, policy::check_overflow>(0.5f);
+    c *= safe_float<float, policy::check_overflow>(4.f);
+    BOOST_CHECK_EQUAL(c.get_stored_value(), FPT(6));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,145 @@
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <boost/mpl/list.hpp>
+
+#include <cmath>
+#include <functional>
+#include <limits>
+#include <string>
+#include <type_traits>
+
+#include <boost/safe_float/refined.hpp>
+#include <boost/safe_float/policy/on_fail_count.hpp>
+
+//types to be tested
+using test_types=boost::mpl::list<
+    float, double, long double
+>;
+
+using namespace boost::safe_float;
+
+template<class CHECK, class POLICY>
+constexpr bool runs = policy::is_subset<CHECK, POLICY>::value;
+
+template<class FPT>
+using checked_all = policy::compose_check<policy::check_all, policy::check_subnormal_operand>::policy<FPT>;
+
+// A report policy that may throw, and returns after logging the failure
+struct on_fail_log : policy::on_fail_policy {
+    static inline unsigned logged = 0;
+    void report_failure(const std::string&) { ++logged; }
+};
+
+/**
+  This test suite checks the operations of refined values drop the checks the facts of their operands make
+  redundant, and the facts are checked when values are refined.
+  */
+BOOST_AUTO_TEST_SUITE( refined_test_suite )
+
+BOOST_AUTO_TEST_CASE_TEMPLATE( refined_checks_are_dropped, FPT, test_types){
+    using nonzero = nonzero_safe_float<FPT>;
+    using plain = refined_safe_float<FPT, facts::none>;
+    using division_by_nonzero = typename plain::template operation_checks<std::divides<FPT>, facts::nonzero>;
+    static_assert(!runs<policy::check_division_by_zero<FPT>, division_by_nonzero>, "");
+    static_assert(runs<policy::check_division_invalid_result<FPT>, division_by_nonzero>, "");
+    static_assert(runs<policy::check_division_by_zero<FPT>, typename nonzero::template operation_checks<
+                                                               std::divides<FPT>, facts::none>>, "");
+
+    using finite = finite_safe_float<FPT>;
+    using sum = typename finite::template operation_checks<std::plus<FPT>>;
+    static_assert(!runs<policy::check_addition_invalid_result<FPT>, sum>, "");
+    static_assert(runs<policy::check_addition_overflow<FPT>, sum>, "");
+    static_assert(runs<policy::check_addition_inexact<FPT>, sum>, "");
+    // finite values may still be both zero
+    static_assert(runs<policy::check_division_invalid_result<FPT>,
+                       typename finite::template operation_checks<std::divides<FPT>>>, "");
+
+    using normal = normal_safe_float<FPT, checked_all>;
+    using quotient = typename normal::template operation_checks<std::divides<FPT>>;
+    static_assert(!runs<policy::check_division_by_zero<FPT>, quotient>, "");
+    static_assert(!runs<policy::check_division_invalid_result<FPT>, quotient>, "");
+    static_assert(!runs<policy::check_subnormal_operand<FPT>, quotient>, "");
+    static_assert(runs<policy::check_division_underflow<FPT>, quotient>, "");
+
+    // a policy left without checks doesn't throw
+    using divided = nonzero_safe_float<FPT, policy::check_division_by_zero>;
+    using unchecked = refined_safe_float<FPT, facts::none, policy::check_division_by_zero>;
+    static_assert(noexcept(std::declval<const unchecked&>() / std::declval<const divided&>()), "");
+    static_assert(!noexcept(std::declval<const unchecked&>() / std::declval<const unchecked&>()), "");
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE( refined_results_keep_facts, FPT, test_types){
+    finite_safe_float<FPT> const a(FPT(3));
+    nonzero_safe_float<FPT> const b(FPT(2));
+    auto const quotient = a / b;
+    BOOST_CHECK_EQUAL(quotient.get_stored_value(), FPT(1.5));
+    static_assert(decltype(quotient)::known_facts == facts::none, "");
+
+    // the overflow checks prove finite the results of finite values
+    finite_safe_float<FPT> const sum = a + a;
+    BOOST_CHECK_EQUAL(sum.get_stored_value(), FPT(6));
+    static_assert(decltype(a * a)::known_facts == facts::finite, "");
+    normal_safe_float<FPT> const n(FPT(4));
+    static_assert(decltype(n / n)::known_facts == facts::finite, "");
+    finite_safe_float<FPT> const huge(std::numeric_limits<FPT>::max());
+    BOOST_CHECK_THROW(huge * huge, std::exception);
+
+    // without stopping the operations the results have no facts
+    using counted = finite_safe_float<FPT, policy::check_all, policy::on_fail_count>;
+    static_assert(decltype(counted(FPT(1)) + counted(FPT(1)))::known_facts == facts::none, "");
+    static_assert(!detail::stops_on_failure<on_fail_log>(), "");
+    using logged = finite_safe_float<FPT, policy::check_all, on_fail_log>;
+    static_assert(decltype(logged(FPT(1)) + logged(FPT(1)))::known_facts == facts::none, "");
+    on_fail_log::logged = 0;
+    logged const infinite(std::numeric_limits<FPT>::infinity());
+    BOOST_CHECK_EQUAL(on_fail_log::logged, 1u);
+    BOOST_CHECK(std::isinf(infinite.get_stored_value()));
+
+    // operations with safe_float values, and conversions to them
+    safe_float<FPT> const c(FPT(0.5));
+    BOOST_CHECK_EQUAL((a * c).get_stored_value(), FPT(1.5));
+    BOOST_CHECK_EQUAL((c * a).get_stored_value(), FPT(1.5));
+    safe_float<FPT> const back = a;
+    BOOST_CHECK_EQUAL(back.get_stored_value(), FPT(3));
+    finite_safe_float<FPT> const weaker = n;
+    BOOST_CHECK_EQUAL(weaker.get_stored_value(), FPT(4));
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE( refine_checks_facts, FPT, test_types){
+    safe_float<FPT> const zero(FPT(0));
+    safe_float<FPT> const infinite(std::numeric_limits<FPT>::infinity());
+    BOOST_CHECK_EQUAL(refine<facts::finite>(zero).get_stored_value(), FPT(0));
+    BOOST_CHECK_THROW(refine<facts::nonzero>(zero), std::exception);
+    BOOST_CHECK_THROW(refine<facts::finite>(infinite), std::exception);
+    BOOST_CHECK_NO_THROW(refine<facts::nonzero>(infinite));
+    BOOST_CHECK_THROW(normal_safe_float<FPT>(std::numeric_limits<FPT>::denorm_min()), std::exception);
+    BOOST_CHECK_THROW(finite_safe_float<FPT>(std::numeric_limits<FPT>::quiet_NaN()), std::exception);
+
+    auto const both = refine<facts::nonzero>(finite_safe_float<FPT>(FPT(2)));
+    static_assert(decltype(both)::known_facts == (facts::finite | facts::nonzero), "");
+    BOOST_CHECK_THROW(nonzero_safe_float<FPT>(finite_safe_float<FPT>(FPT(0))), std::exception);
+
+    // failures that don't stop are reported when the value is refined, and the operations still check it
+    using counted = safe_float<FPT, policy::check_all, policy::on_fail_count>;
+    policy::on_fail_count::reset();
+    auto const divisor = refine<facts::nonzero>(counted(FPT(0)));
+    BOOST_CHECK_EQUAL(policy::on_fail_count::count(), 1u);
+    refined_safe_float<FPT, facts::finite | facts::nonzero, policy::check_all, policy::on_fail_count> const one(FPT(1));
+    policy::on_fail_count::reset();
+    auto const quotient = one / divisor;
+    BOOST_CHECK_EQUAL(quotient.get_stored_value(), std::numeric_limits<FPT>::infinity());
+    BOOST_CHECK(policy::on_fail_count::count() > 0u);
+    using nonzero = nonzero_safe_float<FPT, policy::check_all, policy::on_fail_count>;
+    static_assert(runs<policy::check_division_by_zero<FPT>,
+                       typename nonzero::template operation_checks<std::divides<FPT>, facts::nonzero>>, "");
+    static_assert(runs<policy::check_division_invalid_result<FPT>,
+                       typename nonzero::template operation_checks<std::divides<FPT>, facts::nonzero>>, "");
+    policy::on_fail_count::reset();
+    nonzero const none(FPT(0));
+    BOOST_CHECK_EQUAL(policy::on_fail_count::count(), 1u);
+    BOOST_CHECK(std::isnan((none / none).get_stored_value()));
+    BOOST_CHECK(policy::on_fail_count::count() > 1u);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
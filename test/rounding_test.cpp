@@ -0,0 +1,85 @@
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <boost/mpl/list.hpp>
+
+#include <cfenv>
+#include <limits>
+
+#include <boost/safe_float.hpp>
+#include <boost/safe_float/rounding.hpp>
+#include <boost/safe_float/policy/on_fail_count.hpp>
+
+//types to be tested
+using test_types=boost::mpl::list<
+    float, double, long double
+>;
+
+using namespace boost::safe_float;
+
+/**
+  This test suite checks the rounding scope sets and restores the rounding direction.
+  */
+BOOST_AUTO_TEST_SUITE( safe_float_rounding_test_suite )
+
+BOOST_AUTO_TEST_CASE_TEMPLATE( safe_float_rounding_scope_direction, FPT, test_types){
+    volatile FPT one = FPT(1);
+    volatile FPT three = FPT(3);
+    BOOST_CHECK(rounding_scope::current<FPT>() == rounding_mode::to_nearest);
+    FPT down, up, zero, negative_down, negative_zero;
+    {
+        rounding_scope scope(rounding_mode::downward);
+        BOOST_CHECK(rounding_scope::current<FPT>() == rounding_mode::downward);
+        down = one / three;
+        negative_down = -one / three;
+    }
+    {
+        rounding_scope scope(rounding_mode::upward);
+        up = one / three;
+    }
+    {
+        rounding_scope scope(rounding_mode::toward_zero);
+        zero = one / three;
+        negative_zero = -one / three;
+    }
+    BOOST_CHECK(rounding_scope::current<FPT>() == rounding_mode::to_nearest);
+    BOOST_CHECK(down < up);
+    BOOST_CHECK_EQUAL(down, zero);
+    BOOST_CHECK(negative_down < negative_zero);
+    BOOST_CHECK(std::fegetround() == FE_TONEAREST);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE( safe_float_rounding_scope_nested, FPT, test_types){
+    {
+        rounding_scope outer(rounding_mode::upward);
+        {
+            // same mode, nothing is written and nothing is restored
+            rounding_scope inner(rounding_mode::upward);
+            BOOST_CHECK(rounding_scope::current<FPT>() == rounding_mode::upward);
+        }
+        BOOST_CHECK(rounding_scope::current<FPT>() == rounding_mode::upward);
+        {
+            rounding_scope inner(rounding_mode::toward_zero);
+            BOOST_CHECK(rounding_scope::current<FPT>() == rounding_mode::toward_zero);
+        }
+        BOOST_CHECK(rounding_scope::current<FPT>() == rounding_mode::upward);
+    }
+    BOOST_CHECK(rounding_scope::current<FPT>() == rounding_mode::to_nearest);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE( safe_float_rounding_scope_safe_float, FPT, test_types){
+    using sf = safe_float<FPT, policy::check_overflow, policy::on_fail_count>;
+    sf max = std::numeric_limits<FPT>::max();
+    sf two = FPT(2);
+    policy::on_fail_count::reset();
+    {
+        rounding_scope scope(rounding_mode::toward_zero);
+        // rounding toward zero the overflow saturates to max()
+        BOOST_CHECK_EQUAL((max * two).get_stored_value(), std::numeric_limits<FPT>::max());
+    }
+    // the flags report it, the value checks only see a finite result
+    BOOST_CHECK_EQUAL(policy::on_fail_count::count(), detail::tests_fenv<FPT>() ? 1u : 0u);
+    policy::on_fail_count::reset();
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,72 @@
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <boost/mpl/list.hpp>
+
+#include <limits>
+
+#include <boost/safe_float/safe_ref.hpp>
+#include <boost/safe_float/policy/on_fail_count.hpp>
+
+//types to be tested
+using test_types=boost::mpl::list<
+    float, double, long double
+>;
+
+using namespace boost::safe_float;
+
+// legacy structure of arrays that can't hold safe floats
+template<class FPT>
+struct particles {
+    FPT position[4];
+    FPT velocity[4];
+};
+
+/**
+  This test suite checks the operations through safe_ref are checked and written in place.
+  */
+BOOST_AUTO_TEST_SUITE( safe_ref_test_suite )
+
+BOOST_AUTO_TEST_CASE_TEMPLATE( safe_ref_writes_in_place, FPT, test_types){
+    particles<FPT> p{{FPT(1), FPT(2), FPT(3), FPT(4)}, {FPT(0.5), FPT(0.5), FPT(0.5), FPT(0.5)}};
+    for (int i = 0; i < 4; ++i) {
+        safe_ref<FPT> position(p.position[i]);
+        position += p.velocity[i];
+        position *= FPT(2);
+        position -= safe_float<FPT>(FPT(1));
+        position /= safe_ref<FPT>(p.velocity[i]);
+    }
+    BOOST_CHECK_EQUAL(p.position[0], FPT(4));
+    BOOST_CHECK_EQUAL(p.position[3], FPT(16));
+    BOOST_CHECK_EQUAL(p.velocity[0], FPT(0.5));
+
+    // assignments write the referenced value, copies refer to the same value
+    safe_ref<FPT> first(p.position[0]);
+    safe_ref<FPT> copy = first;
+    copy = FPT(7);
+    BOOST_CHECK_EQUAL(p.position[0], FPT(7));
+    first = safe_ref<FPT>(p.position[1]);
+    BOOST_CHECK_EQUAL(p.position[0], p.position[1]);
+    BOOST_CHECK_EQUAL(static_cast<FPT>(first), p.position[1]);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE( safe_ref_reports_failures, FPT, test_types){
+    FPT value = std::numeric_limits<FPT>::max();
+    safe_ref<FPT, policy::check_addition_overflow> overflow(value);
+    BOOST_CHECK_THROW(overflow += std::numeric_limits<FPT>::max(), std::exception);
+
+    FPT divided = FPT(1);
+    safe_ref<FPT, policy::check_division_by_zero> by_zero(divided);
+    BOOST_CHECK_THROW(by_zero /= FPT(0), std::exception);
+    BOOST_CHECK_EQUAL(divided, FPT(1));
+
+    // the reference is nothrow when the policies are
+    FPT counted = FPT(1);
+    safe_ref<FPT, policy::check_division_by_zero, policy::on_fail_count> count(counted);
+    static_assert(noexcept(count /= FPT(0)));
+    policy::on_fail_count::reset();
+    count /= FPT(0);
+    BOOST_CHECK_EQUAL(policy::on_fail_count::count(), 1u);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,213 @@
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <boost/mpl/list.hpp>
+
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include <boost/safe_float/allocator.hpp>
+#include <boost/safe_float/safe_vector.hpp>
+#include <boost/safe_float/policy/check_flush_to_zero.hpp>
+#include <boost/safe_float/policy/on_fail_count.hpp>
+
+//types to be tested
+using test_types=boost::mpl::list<
+    float, double, long double
+>;
+
+using namespace boost::safe_float;
+
+/**
+  This test suite checks the bulk operations of safe_vector give the results and report the failures
+  of the same operations applied to each element.
+  */
+BOOST_AUTO_TEST_SUITE( safe_vector_test_suite )
+
+BOOST_AUTO_TEST_CASE_TEMPLATE( safe_vector_bulk_operations, FPT, test_types){
+    // sizes covering several blocks and a partial one
+    std::size_t const n = 1000;
+    safe_vector<FPT> v(n);
+    safe_vector<FPT> w(n);
+    for (std::size_t i = 0; i != n; ++i) {
+        v[i] = FPT(i);
+        w[i] = FPT(2);
+    }
+    v += w;
+    v *= FPT(4);
+    v -= FPT(8);
+    v /= w;
+    for (std::size_t i = 0; i != n; ++i) BOOST_CHECK_EQUAL(v[i], FPT(2 * i));
+
+    // an operand of another size is rejected
+    safe_vector<FPT> shorter(n - 1);
+    BOOST_CHECK_THROW(v += shorter, std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE( safe_vector_element_proxies, FPT, test_types){
+    safe_vector<FPT, policy::check_division_by_zero> v{FPT(1), FPT(2), FPT(3)};
+    v[0] += FPT(1);
+    v[1] *= v[2];
+    v.at(2) -= FPT(1);
+    BOOST_CHECK_EQUAL(v[0], FPT(2));
+    BOOST_CHECK_EQUAL(v[1], FPT(6));
+    BOOST_CHECK_EQUAL(v[2], FPT(2));
+    BOOST_CHECK_THROW(v[0] /= FPT(0), std::exception);
+    BOOST_CHECK_EQUAL(v[0], FPT(2));
+    BOOST_CHECK_THROW(v.at(3), std::out_of_range);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE( safe_vector_reports_failures, FPT, test_types){
+    std::size_t const n = 600;
+    FPT const max = std::numeric_limits<FPT>::max();
+
+    // the elements before the failure are written, the ones after are not
+    safe_vector<FPT, policy::check_addition_overflow> v(n, FPT(1));
+    v[300] = max;
+    BOOST_CHECK_THROW(v += max, std::exception);
+    BOOST_CHECK_EQUAL(v[299], FPT(1) + max);
+    BOOST_CHECK_EQUAL(v[301], FPT(1));
+
+    // each failure is reported once
+    safe_vector<FPT, policy::check_division_by_zero, policy::on_fail_count> counted(n, FPT(1));
+    safe_vector<FPT, policy::check_division_by_zero, policy::on_fail_count> divisors(n, FPT(1));
+    divisors[3] = FPT(0);
+    divisors[257] = FPT(0);
+    divisors[599] = FPT(0);
+    static_assert(noexcept(counted /= FPT(1)));
+    policy::on_fail_count::reset();
+    counted /= divisors;
+    BOOST_CHECK_EQUAL(policy::on_fail_count::count(), 3u);
+    BOOST_CHECK_EQUAL(counted[2], FPT(1));
+
+    safe_vector<FPT, policy::check_all, policy::on_fail_count> underflow(n, std::numeric_limits<FPT>::min());
+    policy::on_fail_count::reset();
+    underflow *= FPT(1);
+    BOOST_CHECK_EQUAL(policy::on_fail_count::count(), 0u);
+    underflow /= FPT(4);
+    BOOST_CHECK_EQUAL(policy::on_fail_count::count(), n);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE( safe_vector_poisons_failing_elements, FPT, test_types){
+    using poisoning = safe_vector<FPT, policy::check_overflow, policy::on_fail_poison>;
+    std::size_t const n = 700;
+    FPT const max = std::numeric_limits<FPT>::max();
+
+    poisoning v(n, FPT(1));
+    v[5] = max;
+    v[640] = max;
+    static_assert(noexcept(v += max));
+    v *= FPT(4);
+    BOOST_CHECK_EQUAL(v.invalid_count(), 2u);
+    BOOST_CHECK(! v.valid(5));
+    BOOST_CHECK(v.valid(6));
+    BOOST_CHECK_EQUAL(v[6], FPT(4));
+    BOOST_CHECK_EQUAL(v[699], FPT(4));
+
+    // invalid elements of the right operand propagate
+    poisoning w(n, FPT(1));
+    w[64] *= max;
+    w[64] *= max;
+    BOOST_CHECK(! w[64].valid());
+    v += w;
+    BOOST_CHECK_EQUAL(v.invalid_count(), 3u);
+    BOOST_CHECK((v.invalid_indexes() == std::vector<std::size_t>{5, 64, 640}));
+    BOOST_CHECK_EQUAL(v.validity_bitmap()[0], ~std::uint64_t(0) & ~(std::uint64_t(1) << 5));
+    BOOST_CHECK_EQUAL(v.validity_bitmap()[1], ~std::uint64_t(0) & ~std::uint64_t(1));
+
+    // assigning an element makes it valid, added elements are valid
+    v[5] = FPT(1);
+    v.push_back(FPT(1));
+    v.resize(n + 100, FPT(1));
+    BOOST_CHECK_EQUAL(v.invalid_count(), 2u);
+    v.resize(600);
+    BOOST_CHECK_EQUAL(v.invalid_count(), 1u);
+    v.reset_validity();
+    BOOST_CHECK_EQUAL(v.invalid_count(), 0u);
+    BOOST_CHECK(v.invalid_indexes().empty());
+}
+
+template<class FPT, template<class> class CHECK>
+void check_overflow_before_infinite_operand()
+{
+    safe_vector<FPT, CHECK, policy::on_fail_count> v(4, FPT(1));
+    safe_vector<FPT, CHECK, policy::on_fail_count> w(4, FPT(1));
+    v[0] = std::numeric_limits<FPT>::max();
+    w[0] = std::numeric_limits<FPT>::max();
+    v[3] = std::numeric_limits<FPT>::infinity();
+    policy::on_fail_count::reset();
+    v += w;
+    BOOST_CHECK_EQUAL(v[0], std::numeric_limits<FPT>::infinity());
+    BOOST_CHECK_EQUAL(v[3], std::numeric_limits<FPT>::infinity());
+    BOOST_CHECK_EQUAL(policy::on_fail_count::count(), 1u);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE( safe_vector_checks_each_element_state, FPT, test_types){
+    // the overflow of an element is reported when an infinite operand ends the block, also when a
+    // policy reading the flags is composed
+    check_overflow_before_infinite_operand<FPT, policy::check_addition_overflow>();
+    check_overflow_before_infinite_operand<
+        FPT, policy::compose_check<policy::check_addition_overflow, policy::check_flush_to_zero>::policy>();
+    check_overflow_before_infinite_operand<FPT, policy::check_overflow>();
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE( safe_vector_validates_dirty_blocks, FPT, test_types){
+    using counting = safe_vector<FPT, policy::check_all, policy::on_fail_count>;
+    std::size_t const block = counting::validation_block_size;
+    counting v(4 * block + 10, FPT(1));
+    BOOST_CHECK_EQUAL(v.dirty_blocks(), 5u);
+    BOOST_CHECK(v.validate());
+    BOOST_CHECK_EQUAL(v.dirty_blocks(), 0u);
+
+    // only the blocks written are validated again, a failing block keeps its result
+    policy::on_fail_count::reset();
+    v[block + 1] = std::numeric_limits<FPT>::quiet_NaN();
+    v[3 * block] = std::numeric_limits<FPT>::denorm_min();
+    v[3 * block + 1] += FPT(1);
+    BOOST_CHECK_EQUAL(v.dirty_blocks(), 2u);
+    BOOST_CHECK(! v.validate());
+    BOOST_CHECK_EQUAL(policy::on_fail_count::count(), 2u);
+    BOOST_CHECK(! v.validate());
+    BOOST_CHECK_EQUAL(policy::on_fail_count::count(), 2u);
+    v[block + 1] = FPT(1);
+    v[3 * block] = FPT(0);
+    BOOST_CHECK(v.validate());
+
+    // writes through data() are marked explicitly, growing marks the blocks receiving elements
+    v.data()[2 * block] = std::numeric_limits<FPT>::infinity();
+    BOOST_CHECK(v.validate());
+    v.mark_dirty(2 * block, 1);
+    BOOST_CHECK(! v.validate());
+    v.data()[2 * block] = FPT(1);
+    v.mark_dirty(2 * block, 1);
+    v.push_back(FPT(1));
+    BOOST_CHECK_EQUAL(v.dirty_blocks(), 2u);
+    BOOST_CHECK(v.validate());
+
+    // bulk operations mark every block, poisoning marks the invalid values
+    v *= FPT(2);
+    BOOST_CHECK_EQUAL(v.dirty_blocks(), 5u);
+    BOOST_CHECK(v.validate());
+    safe_vector<FPT, policy::check_all, policy::on_fail_poison> poisoned(2 * block, FPT(1));
+    poisoned[block + 3] = -std::numeric_limits<FPT>::infinity();
+    BOOST_CHECK(! poisoned.validate());
+    BOOST_CHECK((poisoned.invalid_indexes() == std::vector<std::size_t>{block + 3}));
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE( safe_vector_allocators, FPT, test_types){
+    safe_vector<FPT, policy::check_all, policy::on_fail_throw, aligned_allocator<FPT>> aligned(100, FPT(1));
+    BOOST_CHECK_EQUAL(reinterpret_cast<std::uintptr_t>(aligned.data()) % 64, 0u);
+    aligned *= FPT(3);
+    BOOST_CHECK_EQUAL(aligned[99], FPT(3));
+
+    std::size_t const n = huge_page_allocator<FPT>::huge_page_size / sizeof(FPT) + 1;
+    safe_vector<FPT, policy::check_all, policy::on_fail_throw, huge_page_allocator<FPT>> huge(n, FPT(1));
+    BOOST_CHECK_EQUAL(reinterpret_cast<std::uintptr_t>(huge.data()) % huge_page_allocator<FPT>::huge_page_size, 0u);
+    huge += huge;
+    BOOST_CHECK_EQUAL(huge[n - 1], FPT(2));
+    safe_vector<FPT, policy::check_all, policy::on_fail_throw, huge_page_allocator<FPT>> small(4, FPT(1));
+    BOOST_CHECK_EQUAL(reinterpret_cast<std::uintptr_t>(small.data()) % 64, 0u);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,109 @@
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <boost/mpl/list.hpp>
+
+#include <limits>
+#include <type_traits>
+#include <utility>
+
+#include <boost/safe_float.hpp>
+
+//types to be tested
+using test_types=boost::mpl::list<
+    float, double, long double
+>;
+
+using namespace boost::safe_float;
+
+// casts implicitly integers and the value type
+template<typename SF>
+struct from_integral
+{
+    template<typename T>
+    static constexpr bool can_cast_from
+        = std::is_integral<T>::value || std::is_same<T, typename SF::value_type>::value;
+
+    template<typename T>
+    static constexpr bool can_explicitly_cast_from = false;
+
+    template<typename T>
+    static constexpr void cast_from(typename SF::value_type& target, T source) noexcept
+    {
+        target = static_cast<typename SF::value_type>(source);
+    }
+
+    template<typename T>
+    static constexpr bool can_cast_to = false;
+
+    template<typename T>
+    static constexpr bool can_explicitly_cast_to = false;
+};
+
+template<typename L, typename R, typename = void>
+struct multipliable : std::false_type
+{};
+
+template<typename L, typename R>
+struct multipliable<L, R, std::void_t<decltype(std::declval<L>() * std::declval<R>())>> : std::true_type
+{};
+
+/**
+  This test suite checks the operations with scalar operands the cast policy accepts, and the operations reusing
+  expiring operands.
+  */
+BOOST_AUTO_TEST_SUITE( scalar_operand_test_suite )
+
+BOOST_AUTO_TEST_CASE_TEMPLATE( scalar_operands, FPT, test_types){
+    safe_float<FPT> const a(FPT(3));
+    BOOST_CHECK_EQUAL((a * FPT(2)).get_stored_value(), FPT(6));
+    BOOST_CHECK_EQUAL((FPT(2) * a).get_stored_value(), FPT(6));
+    BOOST_CHECK_EQUAL((a - FPT(1)).get_stored_value(), FPT(2));
+    BOOST_CHECK_EQUAL((FPT(1) - a).get_stored_value(), FPT(-2));
+    BOOST_CHECK_EQUAL((a / FPT(2)).get_stored_value(), FPT(1.5));
+    BOOST_CHECK_EQUAL((FPT(6) / a).get_stored_value(), FPT(2));
+    safe_float<FPT> b(FPT(1));
+    b += FPT(0.5);
+    b *= FPT(4);
+    BOOST_CHECK_EQUAL(b.get_stored_value(), FPT(6));
+
+    // the checks of the operation run on the scalar operand
+    BOOST_CHECK_THROW(a / FPT(0), std::exception);
+    BOOST_CHECK_THROW(FPT(1) / safe_float<FPT>(FPT(0)), std::exception);
+    BOOST_CHECK_THROW(safe_float<FPT>(std::numeric_limits<FPT>::max()) * FPT(2), std::exception);
+    BOOST_CHECK_THROW(std::numeric_limits<FPT>::max() + safe_float<FPT>(std::numeric_limits<FPT>::max()),
+                      std::exception);
+
+    // the scalars the cast policy rejects are not operands
+    static_assert(multipliable<safe_float<FPT>, FPT>::value, "");
+    static_assert(!multipliable<safe_float<FPT>, int>::value, "");
+    static_assert(!multipliable<int, safe_float<FPT>>::value, "");
+    static_assert(!multipliable<safe_float<FPT, policy::check_all, policy::on_fail_throw,
+                                             policy::cast_from_primitive::none>, FPT>::value, "");
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE( integer_operands, FPT, test_types){
+    using integral = safe_float<FPT, policy::check_all, policy::on_fail_throw, from_integral>;
+    integral const a(FPT(3));
+    BOOST_CHECK_EQUAL((a * 2).get_stored_value(), FPT(6));
+    BOOST_CHECK_EQUAL((2 - a).get_stored_value(), FPT(-1));
+    BOOST_CHECK_EQUAL((3u / a).get_stored_value(), FPT(1));
+    integral b(FPT(1));
+    b += 2L;
+    BOOST_CHECK_EQUAL(b.get_stored_value(), FPT(3));
+    BOOST_CHECK_THROW(a / 0, std::exception);
+    static_assert(!multipliable<safe_float<FPT>, int>::value && multipliable<integral, int>::value, "");
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE( expiring_operands, FPT, test_types){
+    safe_float<FPT> const a(FPT(2));
+    safe_float<FPT> const b(FPT(8));
+    // the temporaries of the chain hold the results, on either side
+    BOOST_CHECK_EQUAL((a * (a + b)).get_stored_value(), FPT(20));
+    BOOST_CHECK_EQUAL((b - (a * a)).get_stored_value(), FPT(4));
+    BOOST_CHECK_EQUAL((b / (a + a)).get_stored_value(), FPT(2));
+    BOOST_CHECK_EQUAL(((a + b) * (b - a) / a).get_stored_value(), FPT(30));
+    BOOST_CHECK_THROW(a / (b - b), std::exception);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
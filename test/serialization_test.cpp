@@ -0,0 +1,185 @@
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <boost/mpl/list.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <boost/archive/binary_iarchive.hpp>
+#include <boost/archive/binary_oarchive.hpp>
+#include <boost/archive/text_iarchive.hpp>
+#include <boost/archive/text_oarchive.hpp>
+#include <boost/serialization/vector.hpp>
+
+#include <boost/safe_float/boost_serialization.hpp>
+#include <boost/safe_float/policy/on_fail_count.hpp>
+#include <boost/safe_float/serialization.hpp>
+
+//types to be tested
+using test_types=boost::mpl::list<
+    float, double, long double
+>;
+
+using namespace boost::safe_float;
+
+template<class SF>
+std::string serialized(const std::vector<SF>& values)
+{
+    std::ostringstream out;
+    write_values(out, values.data(), values.size());
+    return out.str();
+}
+
+template<class SF, class VALUES>
+std::vector<SF> converted(const VALUES& values)
+{
+    std::vector<SF> result;
+    for (const auto& value : values) result.emplace_back(value.get_stored_value());
+    return result;
+}
+
+/**
+  This test suite checks serialized values load as they were written, zero copy when the buffer allows it,
+  and are validated whatever the policy of the writer.
+  */
+BOOST_AUTO_TEST_SUITE( serialization_test_suite )
+
+BOOST_AUTO_TEST_CASE_TEMPLATE( serialized_values_round_trip, FPT, test_types){
+    using sf = safe_float<FPT, policy::check_invalid_result>;
+    static_assert(is_layout_compatible_v<sf>);
+    std::vector<sf> values;
+    for (int i = 0; i != 100; ++i) values.emplace_back(FPT(i) / FPT(7));
+    std::string const bytes = serialized(values);
+    BOOST_CHECK_EQUAL(bytes.size(), serialized_size<sf>(values.size()));
+
+    // an aligned buffer is viewed, a misaligned one copied
+    std::vector<long double> aligned(bytes.size() / sizeof(long double) + 1);
+    std::memcpy(aligned.data(), bytes.data(), bytes.size());
+    loaded_values<sf> const viewed = load_values<sf>(aligned.data(), bytes.size());
+    BOOST_CHECK(! viewed.copied());
+    BOOST_CHECK(reinterpret_cast<const void*>(viewed.data()) == reinterpret_cast<const char*>(aligned.data()) + 32);
+    std::vector<char> shifted(bytes.size() + 1);
+    std::memcpy(shifted.data() + 1, bytes.data(), bytes.size());
+    loaded_values<sf> const copied = load_values<sf>(shifted.data() + 1, bytes.size());
+    BOOST_CHECK(copied.copied());
+    BOOST_REQUIRE_EQUAL(copied.size(), values.size());
+
+    // the copies of copied values hold their own values, the ones of views view the buffer
+    auto copy = std::make_unique<loaded_values<sf>>(copied);
+    loaded_values<sf> const copy_of_copy = *copy;
+    copy.reset();
+    BOOST_CHECK(copy_of_copy.data() != copied.data());
+    BOOST_CHECK_EQUAL(copy_of_copy[values.size() - 1].get_stored_value(), values.back().get_stored_value());
+    loaded_values<sf> view_copy;
+    view_copy = viewed;
+    BOOST_CHECK(view_copy.data() == viewed.data());
+    loaded_values<sf> moved(std::move(view_copy));
+    BOOST_CHECK(moved.data() == viewed.data());
+    for (std::size_t i = 0; i != values.size(); ++i)
+    {
+        BOOST_CHECK_EQUAL(viewed[i].get_stored_value(), values[i].get_stored_value());
+        BOOST_CHECK_EQUAL(copied[i].get_stored_value(), values[i].get_stored_value());
+    }
+
+    // values converted to another policy are also read from a stream
+    std::vector<safe_float<FPT>> const checked = converted<safe_float<FPT>>(values);
+    std::istringstream in(serialized(checked));
+    std::vector<safe_float<FPT>> const read = read_values<safe_float<FPT>>(in);
+    BOOST_CHECK((read == checked));
+
+    // the reserved bytes of the header are written as zero and ignored
+    std::uint64_t reserved = 1;
+    std::memcpy(&reserved, bytes.data() + offsetof(detail::serialized_header, reserved), sizeof(reserved));
+    BOOST_CHECK_EQUAL(reserved, 0u);
+    std::memcpy(aligned.data(), bytes.data(), bytes.size());
+    std::memset(reinterpret_cast<char*>(aligned.data()) + offsetof(detail::serialized_header, reserved), 0xff,
+                sizeof(reserved));
+    BOOST_CHECK_EQUAL(load_values<sf>(aligned.data(), bytes.size())[99].get_stored_value(),
+                      values[99].get_stored_value());
+
+    // other types and truncated data are rejected
+    BOOST_CHECK_THROW(load_values<sf>(bytes.data(), bytes.size() - 1), std::invalid_argument);
+    BOOST_CHECK_THROW(load_values<sf>(bytes.data(), 16), std::invalid_argument);
+    using other = std::conditional_t<std::is_same<FPT, float>::value, double, float>;
+    BOOST_CHECK_THROW(load_values<safe_float<other>>(bytes.data(), bytes.size()), std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE( loaded_values_validation, FPT, test_types){
+    using unchecked = safe_float<FPT, policy::check_division_by_zero>;
+    using overflow_checked = safe_float<FPT, policy::check_overflow, policy::on_fail_count>;
+    using bothflow_checked = safe_float<FPT, policy::check_bothflow, policy::on_fail_count>;
+    std::vector<unchecked> values(1000, unchecked(FPT(1)));
+    values[10] = unchecked(std::numeric_limits<FPT>::infinity());
+    values[20] = unchecked(std::numeric_limits<FPT>::denorm_min());
+    values[30] = unchecked(std::numeric_limits<FPT>::denorm_min());
+    std::string const bytes = serialized(values);
+
+    // values written without the checks of the reader are validated
+    policy::on_fail_count::reset();
+    loaded_values<overflow_checked> const overflows = load_values<overflow_checked>(bytes.data(), bytes.size());
+    BOOST_CHECK_EQUAL(overflows.validation().infinite.first, 10u);
+    BOOST_CHECK_EQUAL(policy::on_fail_count::count(), 1u);
+    load_values<bothflow_checked>(bytes.data(), bytes.size());
+    BOOST_CHECK_EQUAL(policy::on_fail_count::count(), 3u);
+
+    // values written with every check of the reader are validated too, they were stored without a checked
+    // operation, and the report policy of the writer continues after its failures
+    std::vector<bothflow_checked> const checked = converted<bothflow_checked>(values);
+    std::string const checked_bytes = serialized(checked);
+    policy::on_fail_count::reset();
+    loaded_values<overflow_checked> const checked_overflows
+        = load_values<overflow_checked>(checked_bytes.data(), checked_bytes.size());
+    BOOST_CHECK_EQUAL(checked_overflows.validation().values, values.size());
+    BOOST_CHECK_EQUAL(checked_overflows.validation().infinite.first, 10u);
+    BOOST_CHECK_EQUAL(policy::on_fail_count::count(), 1u);
+    std::istringstream in(checked_bytes);
+    read_values<bothflow_checked>(in);
+    BOOST_CHECK_EQUAL(policy::on_fail_count::count(), 3u);
+    BOOST_CHECK_THROW(load_values<safe_float<FPT>>(checked_bytes.data(), checked_bytes.size()), std::exception);
+    std::vector<safe_float<FPT>> const infinite{safe_float<FPT>(std::numeric_limits<FPT>::infinity())};
+    std::string const infinite_bytes = serialized(infinite);
+    BOOST_CHECK_THROW(load_values<safe_float<FPT>>(infinite_bytes.data(), infinite_bytes.size()), std::exception);
+
+    static_assert(detail::policy_identity<FPT, policy::check_all<FPT>>()
+                  == (detail::policy_identity<FPT, policy::check_bothflow<FPT>>()
+                      | detail::policy_identity<FPT, policy::check_inexact_rounding<FPT>>()
+                      | detail::policy_identity<FPT, policy::check_invalid_result<FPT>>()
+                      | detail::policy_identity<FPT, policy::check_division_by_zero<FPT>>()
+                      | detail::policy_identity<FPT, policy::check_function_errors<FPT>>()));
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE( boost_serialization_archives, FPT, test_types){
+    using sf = safe_float<FPT, policy::check_bothflow>;
+    std::vector<sf> const values{sf(FPT(1.5)), sf(FPT(-0.1)), sf(std::numeric_limits<FPT>::max())};
+    std::stringstream binary;
+    {
+        boost::archive::binary_oarchive archive(binary);
+        archive << values;
+    }
+    std::vector<sf> loaded;
+    {
+        boost::archive::binary_iarchive archive(binary);
+        archive >> loaded;
+    }
+    BOOST_CHECK((loaded == values));
+
+    // loading checks the values
+    safe_float<FPT, policy::check_division_by_zero> const infinite(std::numeric_limits<FPT>::infinity());
+    std::stringstream text;
+    {
+        boost::archive::text_oarchive archive(text);
+        archive << infinite;
+    }
+    boost::archive::text_iarchive archive(text);
+    sf checked;
+    BOOST_CHECK_THROW(archive >> checked, std::exception);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
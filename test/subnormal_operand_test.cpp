@@ -0,0 +1,70 @@
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <boost/mpl/list.hpp>
+
+#include <cmath>
+#include <limits>
+
+#include <boost/safe_float.hpp>
+#include <boost/safe_float/detail/ieee754.hpp>
+#include <boost/safe_float/policy/on_fail_count.hpp>
+
+//types to be tested
+using test_types=boost::mpl::list<
+    float, double, long double
+>;
+
+using namespace boost::safe_float;
+
+/**
+  This test suite checks the detection of subnormal operands and the counting of failures.
+  */
+BOOST_AUTO_TEST_SUITE( safe_float_subnormal_operand_test_suite )
+
+BOOST_AUTO_TEST_CASE_TEMPLATE( safe_float_subnormal_representation, FPT, test_types){
+    BOOST_CHECK(detail::is_subnormal_representation(std::numeric_limits<FPT>::denorm_min()));
+    BOOST_CHECK(detail::is_subnormal_representation(-std::numeric_limits<FPT>::denorm_min()));
+    BOOST_CHECK(detail::is_subnormal_representation(std::numeric_limits<FPT>::min() / 2));
+    BOOST_CHECK(! detail::is_subnormal_representation(std::numeric_limits<FPT>::min()));
+    BOOST_CHECK(! detail::is_subnormal_representation(FPT(0)));
+    BOOST_CHECK(! detail::is_subnormal_representation(-FPT(0)));
+    BOOST_CHECK(! detail::is_subnormal_representation(FPT(1)));
+    BOOST_CHECK(! detail::is_subnormal_representation(std::numeric_limits<FPT>::max()));
+    BOOST_CHECK(! detail::is_subnormal_representation(std::numeric_limits<FPT>::infinity()));
+    BOOST_CHECK(! detail::is_subnormal_representation(std::numeric_limits<FPT>::quiet_NaN()));
+    if (detail::ieee754_format<FPT>::known) {
+        BOOST_CHECK_EQUAL(detail::exponent_field(FPT(0)), 0u);
+        BOOST_CHECK_EQUAL(detail::exponent_field(std::numeric_limits<FPT>::min()), 1u);
+    }
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE( safe_float_check_subnormal_operand, FPT, test_types){
+    policy::check_subnormal_operand<FPT> check;
+    FPT subnormal = std::numeric_limits<FPT>::denorm_min();
+    BOOST_CHECK(check.pre_addition_check(FPT(1), FPT(2)));
+    BOOST_CHECK(! check.pre_addition_check(subnormal, FPT(2)));
+    BOOST_CHECK(! check.pre_subtraction_check(FPT(1), subnormal));
+    BOOST_CHECK(! check.pre_multiplication_check(subnormal, subnormal));
+    BOOST_CHECK(check.pre_division_check(FPT(0), std::numeric_limits<FPT>::min()));
+    //check error message
+    BOOST_CHECK_EQUAL(check.addition_failure_message(), std::string("Subnormal operand on addition operation"));
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE( safe_float_count_subnormal_operands, FPT, test_types){
+    using sf = safe_float<FPT, policy::check_subnormal_operand, policy::on_fail_count>;
+    policy::on_fail_count::reset();
+    sf subnormal = std::numeric_limits<FPT>::denorm_min();
+    sf one = FPT(1);
+    sf r = one + one;
+    BOOST_CHECK_EQUAL(policy::on_fail_count::count(), 0u);
+    // the execution continues after each failure
+    r = subnormal * one;
+    r = r + one; // the subnormal result is an operand again
+    r = one / subnormal;
+    BOOST_CHECK_EQUAL(policy::on_fail_count::count(), 3u);
+    policy::on_fail_count::reset();
+    BOOST_CHECK_EQUAL(policy::on_fail_count::count(), 0u);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
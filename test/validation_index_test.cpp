@@ -0,0 +1,136 @@
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <boost/mpl/list.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include <boost/safe_float/validation_index.hpp>
+
+//types to be tested
+using test_types=boost::mpl::list<
+    float, double, long double
+>;
+
+using namespace boost::safe_float;
+
+template<class FPT>
+void write_values(const std::string& path, const std::vector<FPT>& values)
+{
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    file.write(reinterpret_cast<const char*>(values.data()), values.size() * sizeof(FPT));
+}
+
+// rewrites the value at index in place, the file keeps its size. The bytes are written from the vector, so the
+// padding of long double values stays the same when the whole file is written again
+template<class FPT>
+void patch_value(const std::string& path, std::vector<FPT>& values, std::size_t index, FPT value)
+{
+    values[index] = value;
+    std::fstream file(path, std::ios::binary | std::ios::in | std::ios::out);
+    file.seekp(index * sizeof(FPT));
+    file.write(reinterpret_cast<const char*>(&values[index]), sizeof(FPT));
+    file.close();
+    std::filesystem::last_write_time(path, std::filesystem::last_write_time(path) + std::chrono::seconds(1));
+}
+
+/**
+  This test suite checks the sidecar index gives the report of a full validation and only the blocks that
+  changed are scanned again.
+  */
+BOOST_AUTO_TEST_SUITE( validation_index_test_suite )
+
+BOOST_AUTO_TEST_CASE_TEMPLATE( validation_index_rescans_changed_blocks, FPT, test_types){
+    std::size_t const block = (std::size_t(1) << 20) / sizeof(FPT);
+    std::size_t const n = 3 * block + 100;
+    std::filesystem::path const directory = std::filesystem::temp_directory_path();
+    std::string const path = (directory / "safe_float_index_test.bin").string();
+    std::string const index = (directory / "safe_float_index_test.bin.sfidx").string();
+    std::filesystem::remove(index);
+
+    std::vector<FPT> values(n, FPT(1));
+    values[block + 5] = std::numeric_limits<FPT>::quiet_NaN();
+    values[n - 1] = std::numeric_limits<FPT>::denorm_min();
+    write_values(path, values);
+
+    // the first validation scans everything and writes the index
+    validation_report const full = validate_file_indexed<FPT>(path, index, value_range<FPT>(), 2);
+    BOOST_CHECK_EQUAL(full.values, n);
+    BOOST_CHECK_EQUAL(full.scanned, n);
+    BOOST_CHECK_EQUAL(full.nan.first, block + 5);
+    BOOST_CHECK_EQUAL(full.subnormal.first, n - 1);
+    BOOST_CHECK(std::filesystem::exists(index));
+
+    // an unchanged file is not read
+    validation_report const trusted = validate_file_indexed<FPT>(path, index);
+    BOOST_CHECK_EQUAL(trusted.scanned, 0u);
+    BOOST_CHECK_EQUAL(trusted.nan.count, 1u);
+    BOOST_CHECK_EQUAL(trusted.nan.first, block + 5);
+    BOOST_CHECK_EQUAL(trusted.subnormal.count, 1u);
+
+    // only the block that changed is scanned
+    patch_value(path, values, 2 * block + 7, std::numeric_limits<FPT>::infinity());
+    validation_report const patched = validate_file_indexed<FPT>(path, index);
+    BOOST_CHECK_EQUAL(patched.scanned, block);
+    BOOST_CHECK_EQUAL(patched.infinite.first, 2 * block + 7);
+    BOOST_CHECK_EQUAL(patched.nan.count, 1u);
+    BOOST_CHECK_EQUAL(validate_file_indexed<FPT>(path, index).scanned, 0u);
+
+    // a range the exponents can't guarantee scans the blocks for the values out of range
+    validation_report const ranged = validate_file_indexed<FPT>(path, index, value_range<FPT>{FPT(0), FPT(10)});
+    BOOST_CHECK_EQUAL(ranged.scanned, n);
+    BOOST_CHECK_EQUAL(ranged.out_of_range.count, 0u);
+    patch_value(path, values, 3, FPT(-1));
+    validation_report const negative = validate_file_indexed<FPT>(path, index, value_range<FPT>{FPT(0), FPT(10)});
+    BOOST_CHECK_EQUAL(negative.out_of_range.count, 1u);
+    BOOST_CHECK_EQUAL(negative.out_of_range.first, 3u);
+    BOOST_CHECK_EQUAL(validate_file_indexed<FPT>(path, index, value_range<FPT>{FPT(-10), FPT(10)}).scanned, 0u);
+
+    // a file that grew scans its last block and the new ones
+    values.resize(n + block, FPT(2));
+    write_values(path, values);
+    std::filesystem::last_write_time(path, std::filesystem::last_write_time(path) + std::chrono::seconds(2));
+    validation_report const grown = validate_file_indexed<FPT>(path, index);
+    BOOST_CHECK_EQUAL(grown.values, n + block);
+    BOOST_CHECK_EQUAL(grown.scanned, block + 100);
+    BOOST_CHECK_EQUAL(grown.subnormal.first, n - 1);
+
+    std::filesystem::remove(path);
+    std::filesystem::remove(index);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE( validation_index_rejects_corrupted_count, FPT, test_types){
+    std::filesystem::path const directory = std::filesystem::temp_directory_path();
+    std::string const path = (directory / "safe_float_index_count_test.bin").string();
+    std::string const index = (directory / "safe_float_index_count_test.bin.sfidx").string();
+    std::filesystem::remove(index);
+    std::vector<FPT> values(1000, FPT(1));
+    values[10] = std::numeric_limits<FPT>::infinity();
+    write_values(path, values);
+    BOOST_CHECK_EQUAL(validate_file_indexed<FPT>(path, index).scanned, 1000u);
+
+    // a count of blocks the index doesn't hold is not trusted, the file is scanned again
+    {
+        std::fstream file(index, std::ios::binary | std::ios::in | std::ios::out);
+        std::uint64_t const blocks = std::numeric_limits<std::uint64_t>::max() / 2;
+        file.seekp(offsetof(detail::index_header, blocks));
+        file.write(reinterpret_cast<const char*>(&blocks), sizeof(blocks));
+    }
+    validation_report const rescanned = validate_file_indexed<FPT>(path, index);
+    BOOST_CHECK_EQUAL(rescanned.scanned, 1000u);
+    BOOST_CHECK_EQUAL(rescanned.infinite.count, 1u);
+    BOOST_CHECK_EQUAL(rescanned.infinite.first, 10u);
+    BOOST_CHECK_EQUAL(validate_file_indexed<FPT>(path, index).scanned, 0u);
+
+    std::filesystem::remove(path);
+    std::filesystem::remove(index);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
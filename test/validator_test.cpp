@@ -0,0 +1,93 @@
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <boost/mpl/list.hpp>
+
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <string>
+#include <system_error>
+#include <vector>
+
+#include <boost/safe_float/validator.hpp>
+
+//types to be tested
+using test_types=boost::mpl::list<
+    float, double, long double
+>;
+
+using namespace boost::safe_float;
+
+template<class FPT>
+std::vector<FPT> dataset(std::size_t n)
+{
+    std::vector<FPT> values(n, FPT(1));
+    values[7] = std::numeric_limits<FPT>::quiet_NaN();
+    values[n - 1] = std::numeric_limits<FPT>::quiet_NaN();
+    values[5000] = -std::numeric_limits<FPT>::infinity();
+    values[20000] = std::numeric_limits<FPT>::denorm_min();
+    values[30000] = FPT(1000);
+    values[30001] = FPT(-1000);
+    return values;
+}
+
+template<class FPT>
+void check_report(const validation_report& report, std::size_t n)
+{
+    BOOST_CHECK_EQUAL(report.values, n);
+    BOOST_CHECK_EQUAL(report.failures(), 6u);
+    BOOST_CHECK_EQUAL(report.nan.count, 2u);
+    BOOST_CHECK_EQUAL(report.nan.first, 7u);
+    BOOST_CHECK_EQUAL(report.infinite.count, 1u);
+    BOOST_CHECK_EQUAL(report.infinite.first, 5000u);
+    BOOST_CHECK_EQUAL(report.subnormal.first, 20000u);
+    BOOST_CHECK_EQUAL(report.out_of_range.count, 2u);
+    BOOST_CHECK_EQUAL(report.out_of_range.first, 30000u);
+}
+
+/**
+  This test suite checks the validator classifies the values as the value checks of the policies, in memory
+  and in files, with one or several threads.
+  */
+BOOST_AUTO_TEST_SUITE( validator_test_suite )
+
+BOOST_AUTO_TEST_CASE_TEMPLATE( validator_classifies_values, FPT, test_types){
+    std::size_t const n = 100000;
+    std::vector<FPT> values = dataset<FPT>(n);
+    value_range<FPT> const range{FPT(-100), FPT(100)};
+    check_report<FPT>(validate_values(values.data(), n, range), n);
+    check_report<FPT>(validate_values(values.data(), n, range, 4), n);
+
+    // the whole range is accepted by default
+    validation_report const unbounded = validate_values(values.data(), n);
+    BOOST_CHECK_EQUAL(unbounded.failures(), 4u);
+    BOOST_CHECK_EQUAL(unbounded.out_of_range.first, value_failures::npos);
+
+    std::vector<FPT> const valid(10, FPT(0));
+    BOOST_CHECK(validate_values(valid.data(), valid.size()).valid());
+    BOOST_CHECK(validate_values(valid.data(), 0).valid());
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE( validator_reads_files, FPT, test_types){
+    std::size_t const n = 100000;
+    std::vector<FPT> values = dataset<FPT>(n);
+    std::string const path = (std::filesystem::temp_directory_path() / "safe_float_validator_test.bin").string();
+    {
+        std::ofstream file(path, std::ios::binary);
+        file.write(reinterpret_cast<const char*>(values.data()), n * sizeof(FPT));
+    }
+    value_range<FPT> const range{FPT(-100), FPT(100)};
+    check_report<FPT>(validate_file<FPT>(path, range, 3), n);
+
+    {
+        std::ofstream file(path, std::ios::binary | std::ios::app);
+        file.put('\0');
+    }
+    BOOST_CHECK_THROW(validate_file<FPT>(path), std::invalid_argument);
+    std::remove(path.c_str());
+    BOOST_CHECK_THROW(validate_file<FPT>(path), std::system_error);
+}
+
+BOOST_AUTO_TEST_SUITE_END()